@@ -37,6 +37,7 @@ NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
 /* Includes:                                                                 */
 /*****************************************************************************/
 #include "aes.h"
+#include "aes_ttable.h"
 #include <string.h> // CBC mode, for memset
 
 /*****************************************************************************/
@@ -233,14 +234,28 @@ static void KeyExpansion(uint8_t *RoundKey, const uint8_t *Key) {
     }
 }
 
-void AES_init_ctx(struct AES_ctx *ctx, const uint8_t *key) {
+void AES_init_ctx_backend(struct AES_ctx *ctx, const uint8_t *key,
+                          enum AES_backend backend) {
     KeyExpansion(ctx->RoundKey, key);
+    if (backend == AES_BACKEND_TTABLE) {
+        AES_ttable_key_setup(ctx->EncKey, ctx->DecKey, ctx->RoundKey);
+    }
+    ctx->Backend = backend;
+}
+
+void AES_init_ctx(struct AES_ctx *ctx, const uint8_t *key) {
+    AES_init_ctx_backend(ctx, key, AES_BACKEND_DEFAULT);
 }
 #if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1))
+void AES_init_ctx_iv_backend(struct AES_ctx *ctx, const uint8_t *key,
+                             const uint8_t *iv, enum AES_backend backend) {
+    AES_init_ctx_backend(ctx, key, backend);
+    memcpy(ctx->Iv, iv, AES_BLOCKLEN);
+}
+
 void AES_init_ctx_iv(struct AES_ctx *ctx, const uint8_t *key,
                      const uint8_t *iv) {
-    KeyExpansion(ctx->RoundKey, key);
-    memcpy(ctx->Iv, iv, AES_BLOCKLEN);
+    AES_init_ctx_iv_backend(ctx, key, iv, AES_BACKEND_DEFAULT);
 }
 void AES_ctx_set_iv(struct AES_ctx *ctx, const uint8_t *iv) {
     memcpy(ctx->Iv, iv, AES_BLOCKLEN);
@@ -457,6 +472,25 @@ static void InvCipher(state_t *state, const uint8_t *RoundKey) {
 }
 #endif // #if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
 
+// EncryptBlock and DecryptBlock dispatch to the context's backend.
+static void EncryptBlock(const struct AES_ctx *ctx, uint8_t *buf) {
+    if (ctx->Backend == AES_BACKEND_TTABLE) {
+        AES_ttable_encrypt(ctx->EncKey, buf);
+    } else {
+        Cipher((state_t *)buf, ctx->RoundKey);
+    }
+}
+
+#if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
+static void DecryptBlock(const struct AES_ctx *ctx, uint8_t *buf) {
+    if (ctx->Backend == AES_BACKEND_TTABLE) {
+        AES_ttable_decrypt(ctx->DecKey, buf);
+    } else {
+        InvCipher((state_t *)buf, ctx->RoundKey);
+    }
+}
+#endif // #if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
+
 /*****************************************************************************/
 /* Public functions:                                                         */
 /*****************************************************************************/
@@ -465,13 +499,13 @@ static void InvCipher(state_t *state, const uint8_t *RoundKey) {
 void AES_ECB_encrypt(const struct AES_ctx *ctx, uint8_t *buf) {
     // The next function call encrypts the PlainText with the Key using AES
     // algorithm.
-    Cipher((state_t *)buf, ctx->RoundKey);
+    EncryptBlock(ctx, buf);
 }
 
 void AES_ECB_decrypt(const struct AES_ctx *ctx, uint8_t *buf) {
     // The next function call decrypts the PlainText with the Key using AES
     // algorithm.
-    InvCipher((state_t *)buf, ctx->RoundKey);
+    DecryptBlock(ctx, buf);
 }
 
 #endif // #if defined(ECB) && (ECB == 1)
@@ -493,7 +527,7 @@ void AES_CBC_encrypt_buffer(struct AES_ctx *ctx, uint8_t *buf,
     uint8_t *Iv = ctx->Iv;
     for (i = 0; i < length; i += AES_BLOCKLEN) {
         XorWithIv(buf, Iv);
-        Cipher((state_t *)buf, ctx->RoundKey);
+        EncryptBlock(ctx, buf);
         Iv = buf;
         buf += AES_BLOCKLEN;
     }
@@ -505,15 +539,47 @@ void AES_CBC_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf,
                             uint32_t length) {
     uintptr_t i;
     uint8_t storeNextIv[AES_BLOCKLEN];
+
+    if (ctx->Backend == AES_BACKEND_TTABLE) {
+        if (length < AES_BLOCKLEN) {
+            return;
+        }
+
+        length -= length % AES_BLOCKLEN;
+        memcpy(storeNextIv, buf + length - AES_BLOCKLEN, AES_BLOCKLEN);
+        AES_ttable_cbc_decrypt(ctx->DecKey, buf, buf, ctx->Iv,
+                               length / AES_BLOCKLEN);
+        memcpy(ctx->Iv, storeNextIv, AES_BLOCKLEN);
+        return;
+    }
+
     for (i = 0; i < length; i += AES_BLOCKLEN) {
         memcpy(storeNextIv, buf, AES_BLOCKLEN);
-        InvCipher((state_t *)buf, ctx->RoundKey);
+        DecryptBlock(ctx, buf);
         XorWithIv(buf, ctx->Iv);
         memcpy(ctx->Iv, storeNextIv, AES_BLOCKLEN);
         buf += AES_BLOCKLEN;
     }
 }
 
+void AES_CBC_decrypt_range(const struct AES_ctx *ctx, const uint8_t *in,
+                           uint8_t *out, uint32_t offset, uint32_t length) {
+    uintptr_t i;
+
+    if (ctx->Backend == AES_BACKEND_TTABLE) {
+        AES_ttable_cbc_decrypt(ctx->DecKey, in + offset, out + offset,
+                               offset ? in + offset - AES_BLOCKLEN : ctx->Iv,
+                               length / AES_BLOCKLEN);
+        return;
+    }
+
+    for (i = offset; i < offset + length; i += AES_BLOCKLEN) {
+        memcpy(out + i, in + i, AES_BLOCKLEN);
+        DecryptBlock(ctx, out + i);
+        XorWithIv(out + i, i == 0 ? ctx->Iv : in + i - AES_BLOCKLEN);
+    }
+}
+
 #endif // #if defined(CBC) && (CBC == 1)
 
 #if defined(CTR) && (CTR == 1)
@@ -530,7 +596,7 @@ void AES_CTR_xcrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length) {
         {
 
             memcpy(buffer, ctx->Iv, AES_BLOCKLEN);
-            Cipher((state_t *)buffer, ctx->RoundKey);
+            EncryptBlock(ctx, buffer);
 
             /* Increment Iv and handle overflow */
             for (bi = (AES_BLOCKLEN - 1); bi >= 0; --bi) {
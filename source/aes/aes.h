@@ -23,17 +23,38 @@
 #define AES_keyExpSize 176
 #endif
 
+// Implementations available to perform block operations with.
+// AES_BACKEND_REFERENCE is the original byte-oriented implementation,
+// retained to cross-check against.
+enum AES_backend {
+    AES_BACKEND_REFERENCE,
+    AES_BACKEND_TTABLE,
+};
+
+#ifndef AES_BACKEND_DEFAULT
+#define AES_BACKEND_DEFAULT AES_BACKEND_TTABLE
+#endif
+
 struct AES_ctx {
     uint8_t RoundKey[AES_keyExpSize];
+    // Round keys as 32-bit words, used by AES_BACKEND_TTABLE.
+    uint32_t EncKey[AES_keyExpSize / 4];
+    uint32_t DecKey[AES_keyExpSize / 4];
+    enum AES_backend Backend;
 #if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1))
     uint8_t Iv[AES_BLOCKLEN];
 #endif
 };
 
+// Initializers select AES_BACKEND_DEFAULT, unless otherwise specified.
 void AES_init_ctx(struct AES_ctx *ctx, const uint8_t *key);
+void AES_init_ctx_backend(struct AES_ctx *ctx, const uint8_t *key,
+                          enum AES_backend backend);
 #if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1))
 void AES_init_ctx_iv(struct AES_ctx *ctx, const uint8_t *key,
                      const uint8_t *iv);
+void AES_init_ctx_iv_backend(struct AES_ctx *ctx, const uint8_t *key,
+                             const uint8_t *iv, enum AES_backend backend);
 void AES_ctx_set_iv(struct AES_ctx *ctx, const uint8_t *iv);
 #endif
 
@@ -55,6 +76,15 @@ void AES_ECB_decrypt(const struct AES_ctx *ctx, uint8_t *buf);
 void AES_CBC_encrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length);
 void AES_CBC_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length);
 
+// Decrypts only the blocks within [offset, offset + length) of the CBC
+// ciphertext in, writing them to the same position within out.
+// offset and length MUST be multiples of AES_BLOCKLEN, and in must hold
+// all ciphertext up to offset + length, as the block preceding offset
+// (or the IV within ctx) is used for chaining. in and out must not overlap.
+// ctx is not modified.
+void AES_CBC_decrypt_range(const struct AES_ctx *ctx, const uint8_t *in,
+                           uint8_t *out, uint32_t offset, uint32_t length);
+
 #endif // #if defined(CBC) && (CBC == 1)
 
 #if defined(CTR) && (CTR == 1)
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# Generates aes_tables.h, the S-boxes and T-tables aes_ttable.c performs its
+# rounds with. They are constant, so they are stored rather than computed
+# upon first use, which no thread has to wait for. Run from this directory:
+#
+#   python3 aes_tables.py > aes_tables.h
+
+
+def xtime(x):
+    return ((x << 1) ^ (0x1B if x & 0x80 else 0)) & 0xFF
+
+
+def multiply(x, y):
+    result = 0
+    while y:
+        if y & 1:
+            result ^= x
+        x = xtime(x)
+        y >>= 1
+    return result
+
+
+def rotl8(x, shift):
+    return ((x << shift) | (x >> (8 - shift))) & 0xFF
+
+
+def rotr32(x):
+    return ((x >> 8) | (x << 24)) & 0xFFFFFFFF
+
+
+def sboxes():
+    """Walks the multiplicative group of GF(2^8) by powers of 3, yielding
+    each element's inverse alongside it for the S-box's affine transform."""
+    sbox = [0] * 256
+    p = q = 1
+    while True:
+        p ^= xtime(p)
+
+        q ^= (q << 1) & 0xFF
+        q ^= (q << 2) & 0xFF
+        q ^= (q << 4) & 0xFF
+        if q & 0x80:
+            q ^= 0x09
+
+        sbox[p] = (
+            q ^ rotl8(q, 1) ^ rotl8(q, 2) ^ rotl8(q, 3) ^ rotl8(q, 4) ^ 0x63
+        )
+        if p == 1:
+            break
+    sbox[0] = 0x63
+
+    inv_sbox = [0] * 256
+    for i, s in enumerate(sbox):
+        inv_sbox[s] = i
+    return sbox, inv_sbox
+
+
+def rotations(first):
+    tables = [first]
+    for _ in range(3):
+        tables.append([rotr32(v) for v in tables[-1]])
+    return tables
+
+
+def emit_table(out, ctype, name, values, width, per_line):
+    out.append("static const %s %s[256] = {" % (ctype, name))
+    for i in range(0, 256, per_line):
+        out.append(
+            "    " + " ".join("0x%0*x," % (width, v) for v in values[i : i + per_line])
+        )
+    out.append("};")
+    out.append("")
+
+
+def main():
+    sbox, inv_sbox = sboxes()
+
+    te = [
+        multiply(s, 2) << 24 | s << 16 | s << 8 | multiply(s, 3) for s in sbox
+    ]
+    td = [
+        multiply(s, 0x0E) << 24
+        | multiply(s, 0x09) << 16
+        | multiply(s, 0x0D) << 8
+        | multiply(s, 0x0B)
+        for s in inv_sbox
+    ]
+
+    out = [
+        "/* This is a generated file! Please use aes_tables.py to rebuild */",
+        "",
+    ]
+    emit_table(out, "uint8_t", "Sbox", sbox, 2, 12)
+    emit_table(out, "uint8_t", "InvSbox", inv_sbox, 2, 12)
+    for i, table in enumerate(rotations(te)):
+        emit_table(out, "uint32_t", "Te%d" % i, table, 8, 6)
+    for i, table in enumerate(rotations(td)):
+        emit_table(out, "uint32_t", "Td%d" % i, table, 8, 6)
+
+    print("\n".join(out).rstrip("\n"))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,244 @@
+/*
+
+Table-driven AES, operating on 32-bit columns.
+
+Each T-table combines SubBytes, ShiftRows and MixColumns (or their inverses)
+for a single byte of a column, allowing a full round to be performed with
+16 table lookups and XORs. This is considerably faster than the byte-oriented
+implementation within aes.c, which is retained as a reference.
+
+Tables are generated by aes_tables.py and stored as constants, costing 10 KiB
+of read-only data. Being constant, they are safe to share between threads.
+
+*/
+
+#include "aes_ttable.h"
+#include "aes_tables.h"
+
+#define Nb 4
+
+#if defined(AES256) && (AES256 == 1)
+#define Nr 14
+#elif defined(AES192) && (AES192 == 1)
+#define Nr 12
+#else
+#define Nr 10
+#endif
+
+#define GETU32(p)                                                              \
+    (((uint32_t)(p)[0] << 24) ^ ((uint32_t)(p)[1] << 16) ^                     \
+     ((uint32_t)(p)[2] << 8) ^ ((uint32_t)(p)[3]))
+
+#define PUTU32(p, v)                                                           \
+    {                                                                          \
+        (p)[0] = (uint8_t)((v) >> 24);                                         \
+        (p)[1] = (uint8_t)((v) >> 16);                                         \
+        (p)[2] = (uint8_t)((v) >> 8);                                          \
+        (p)[3] = (uint8_t)(v);                                                 \
+    }
+
+void AES_ttable_key_setup(uint32_t *EncKey, uint32_t *DecKey,
+                          const uint8_t *RoundKey) {
+    unsigned i, j, round;
+
+    for (i = 0; i < Nb * (Nr + 1); ++i) {
+        EncKey[i] = GETU32(RoundKey + i * 4);
+    }
+
+    // The equivalent inverse cipher uses round keys in reverse order,
+    // with InvMixColumns applied to all but the first and last.
+    for (round = 0; round <= Nr; ++round) {
+        for (j = 0; j < Nb; ++j) {
+            uint32_t w = EncKey[(Nr - round) * Nb + j];
+            if (round != 0 && round != Nr) {
+                w = Td0[Sbox[w >> 24]] ^ Td1[Sbox[(w >> 16) & 0xff]] ^
+                    Td2[Sbox[(w >> 8) & 0xff]] ^ Td3[Sbox[w & 0xff]];
+            }
+            DecKey[round * Nb + j] = w;
+        }
+    }
+}
+
+void AES_ttable_encrypt(const uint32_t *rk, uint8_t *block) {
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+    unsigned round;
+
+    s0 = GETU32(block) ^ rk[0];
+    s1 = GETU32(block + 4) ^ rk[1];
+    s2 = GETU32(block + 8) ^ rk[2];
+    s3 = GETU32(block + 12) ^ rk[3];
+
+    for (round = 1; round < Nr; ++round) {
+        rk += Nb;
+        t0 = Te0[s0 >> 24] ^ Te1[(s1 >> 16) & 0xff] ^ Te2[(s2 >> 8) & 0xff] ^
+             Te3[s3 & 0xff] ^ rk[0];
+        t1 = Te0[s1 >> 24] ^ Te1[(s2 >> 16) & 0xff] ^ Te2[(s3 >> 8) & 0xff] ^
+             Te3[s0 & 0xff] ^ rk[1];
+        t2 = Te0[s2 >> 24] ^ Te1[(s3 >> 16) & 0xff] ^ Te2[(s0 >> 8) & 0xff] ^
+             Te3[s1 & 0xff] ^ rk[2];
+        t3 = Te0[s3 >> 24] ^ Te1[(s0 >> 16) & 0xff] ^ Te2[(s1 >> 8) & 0xff] ^
+             Te3[s2 & 0xff] ^ rk[3];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    // The last round omits MixColumns.
+    rk += Nb;
+    t0 = ((uint32_t)Sbox[s0 >> 24] << 24) ^
+         ((uint32_t)Sbox[(s1 >> 16) & 0xff] << 16) ^
+         ((uint32_t)Sbox[(s2 >> 8) & 0xff] << 8) ^ Sbox[s3 & 0xff] ^ rk[0];
+    t1 = ((uint32_t)Sbox[s1 >> 24] << 24) ^
+         ((uint32_t)Sbox[(s2 >> 16) & 0xff] << 16) ^
+         ((uint32_t)Sbox[(s3 >> 8) & 0xff] << 8) ^ Sbox[s0 & 0xff] ^ rk[1];
+    t2 = ((uint32_t)Sbox[s2 >> 24] << 24) ^
+         ((uint32_t)Sbox[(s3 >> 16) & 0xff] << 16) ^
+         ((uint32_t)Sbox[(s0 >> 8) & 0xff] << 8) ^ Sbox[s1 & 0xff] ^ rk[2];
+    t3 = ((uint32_t)Sbox[s3 >> 24] << 24) ^
+         ((uint32_t)Sbox[(s0 >> 16) & 0xff] << 16) ^
+         ((uint32_t)Sbox[(s1 >> 8) & 0xff] << 8) ^ Sbox[s2 & 0xff] ^ rk[3];
+
+    PUTU32(block, t0);
+    PUTU32(block + 4, t1);
+    PUTU32(block + 8, t2);
+    PUTU32(block + 12, t3);
+}
+
+void AES_ttable_decrypt(const uint32_t *rk, uint8_t *block) {
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+    unsigned round;
+
+    s0 = GETU32(block) ^ rk[0];
+    s1 = GETU32(block + 4) ^ rk[1];
+    s2 = GETU32(block + 8) ^ rk[2];
+    s3 = GETU32(block + 12) ^ rk[3];
+
+    for (round = 1; round < Nr; ++round) {
+        rk += Nb;
+        t0 = Td0[s0 >> 24] ^ Td1[(s3 >> 16) & 0xff] ^ Td2[(s2 >> 8) & 0xff] ^
+             Td3[s1 & 0xff] ^ rk[0];
+        t1 = Td0[s1 >> 24] ^ Td1[(s0 >> 16) & 0xff] ^ Td2[(s3 >> 8) & 0xff] ^
+             Td3[s2 & 0xff] ^ rk[1];
+        t2 = Td0[s2 >> 24] ^ Td1[(s1 >> 16) & 0xff] ^ Td2[(s0 >> 8) & 0xff] ^
+             Td3[s3 & 0xff] ^ rk[2];
+        t3 = Td0[s3 >> 24] ^ Td1[(s2 >> 16) & 0xff] ^ Td2[(s1 >> 8) & 0xff] ^
+             Td3[s0 & 0xff] ^ rk[3];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    // The last round omits InvMixColumns.
+    rk += Nb;
+    t0 = ((uint32_t)InvSbox[s0 >> 24] << 24) ^
+         ((uint32_t)InvSbox[(s3 >> 16) & 0xff] << 16) ^
+         ((uint32_t)InvSbox[(s2 >> 8) & 0xff] << 8) ^ InvSbox[s1 & 0xff] ^
+         rk[0];
+    t1 = ((uint32_t)InvSbox[s1 >> 24] << 24) ^
+         ((uint32_t)InvSbox[(s0 >> 16) & 0xff] << 16) ^
+         ((uint32_t)InvSbox[(s3 >> 8) & 0xff] << 8) ^ InvSbox[s2 & 0xff] ^
+         rk[1];
+    t2 = ((uint32_t)InvSbox[s2 >> 24] << 24) ^
+         ((uint32_t)InvSbox[(s1 >> 16) & 0xff] << 16) ^
+         ((uint32_t)InvSbox[(s0 >> 8) & 0xff] << 8) ^ InvSbox[s3 & 0xff] ^
+         rk[2];
+    t3 = ((uint32_t)InvSbox[s3 >> 24] << 24) ^
+         ((uint32_t)InvSbox[(s2 >> 16) & 0xff] << 16) ^
+         ((uint32_t)InvSbox[(s1 >> 8) & 0xff] << 8) ^ InvSbox[s0 & 0xff] ^
+         rk[3];
+
+    PUTU32(block, t0);
+    PUTU32(block + 4, t1);
+    PUTU32(block + 8, t2);
+    PUTU32(block + 12, t3);
+}
+
+// DecryptLanes decrypts lanes consecutive CBC blocks at once, interleaving
+// their rounds so that independent table lookups may overlap. Every block
+// of input is read before any output is written, allowing in == out.
+// Callers pass a constant lane count, allowing each loop to be unrolled.
+static inline void DecryptLanes(const uint32_t *DecKey, const uint8_t *in,
+                                uint8_t *out, const uint8_t *iv,
+                                const unsigned lanes) {
+    uint32_t s[AES_INTERLEAVE][4], t[AES_INTERLEAVE][4];
+    const uint32_t *rk = DecKey;
+    unsigned round, b;
+
+    for (b = 0; b < lanes; ++b) {
+        s[b][0] = GETU32(in + b * 16) ^ rk[0];
+        s[b][1] = GETU32(in + b * 16 + 4) ^ rk[1];
+        s[b][2] = GETU32(in + b * 16 + 8) ^ rk[2];
+        s[b][3] = GETU32(in + b * 16 + 12) ^ rk[3];
+    }
+
+    for (round = 1; round < Nr; ++round) {
+        rk += Nb;
+        for (b = 0; b < lanes; ++b) {
+            t[b][0] = Td0[s[b][0] >> 24] ^ Td1[(s[b][3] >> 16) & 0xff] ^
+                      Td2[(s[b][2] >> 8) & 0xff] ^ Td3[s[b][1] & 0xff] ^ rk[0];
+            t[b][1] = Td0[s[b][1] >> 24] ^ Td1[(s[b][0] >> 16) & 0xff] ^
+                      Td2[(s[b][3] >> 8) & 0xff] ^ Td3[s[b][2] & 0xff] ^ rk[1];
+            t[b][2] = Td0[s[b][2] >> 24] ^ Td1[(s[b][1] >> 16) & 0xff] ^
+                      Td2[(s[b][0] >> 8) & 0xff] ^ Td3[s[b][3] & 0xff] ^ rk[2];
+            t[b][3] = Td0[s[b][3] >> 24] ^ Td1[(s[b][2] >> 16) & 0xff] ^
+                      Td2[(s[b][1] >> 8) & 0xff] ^ Td3[s[b][0] & 0xff] ^ rk[3];
+        }
+        for (b = 0; b < lanes; ++b) {
+            s[b][0] = t[b][0];
+            s[b][1] = t[b][1];
+            s[b][2] = t[b][2];
+            s[b][3] = t[b][3];
+        }
+    }
+
+    // The last round omits InvMixColumns. Each block is then XORed with
+    // the ciphertext preceding it.
+    rk += Nb;
+    for (b = 0; b < lanes; ++b) {
+        const uint8_t *chain = b == 0 ? iv : in + (b - 1) * 16;
+        t[b][0] = ((uint32_t)InvSbox[s[b][0] >> 24] << 24) ^
+                  ((uint32_t)InvSbox[(s[b][3] >> 16) & 0xff] << 16) ^
+                  ((uint32_t)InvSbox[(s[b][2] >> 8) & 0xff] << 8) ^
+                  InvSbox[s[b][1] & 0xff] ^ rk[0] ^ GETU32(chain);
+        t[b][1] = ((uint32_t)InvSbox[s[b][1] >> 24] << 24) ^
+                  ((uint32_t)InvSbox[(s[b][0] >> 16) & 0xff] << 16) ^
+                  ((uint32_t)InvSbox[(s[b][3] >> 8) & 0xff] << 8) ^
+                  InvSbox[s[b][2] & 0xff] ^ rk[1] ^ GETU32(chain + 4);
+        t[b][2] = ((uint32_t)InvSbox[s[b][2] >> 24] << 24) ^
+                  ((uint32_t)InvSbox[(s[b][1] >> 16) & 0xff] << 16) ^
+                  ((uint32_t)InvSbox[(s[b][0] >> 8) & 0xff] << 8) ^
+                  InvSbox[s[b][3] & 0xff] ^ rk[2] ^ GETU32(chain + 8);
+        t[b][3] = ((uint32_t)InvSbox[s[b][3] >> 24] << 24) ^
+                  ((uint32_t)InvSbox[(s[b][2] >> 16) & 0xff] << 16) ^
+                  ((uint32_t)InvSbox[(s[b][1] >> 8) & 0xff] << 8) ^
+                  InvSbox[s[b][0] & 0xff] ^ rk[3] ^ GETU32(chain + 12);
+    }
+
+    for (b = 0; b < lanes; ++b) {
+        PUTU32(out + b * 16, t[b][0]);
+        PUTU32(out + b * 16 + 4, t[b][1]);
+        PUTU32(out + b * 16 + 8, t[b][2]);
+        PUTU32(out + b * 16 + 12, t[b][3]);
+    }
+}
+
+void AES_ttable_cbc_decrypt(const uint32_t *DecKey, const uint8_t *in,
+                            uint8_t *out, const uint8_t *iv,
+                            uint32_t blocks) {
+    // Work backwards, so that the ciphertext preceding each group
+    // remains intact when decrypting in place.
+    while (blocks >= AES_INTERLEAVE) {
+        blocks -= AES_INTERLEAVE;
+        const uint8_t *chain = blocks ? in + (blocks - 1) * 16 : iv;
+        DecryptLanes(DecKey, in + blocks * 16, out + blocks * 16, chain,
+                     AES_INTERLEAVE);
+    }
+
+    while (blocks > 0) {
+        blocks -= 1;
+        const uint8_t *chain = blocks ? in + (blocks - 1) * 16 : iv;
+        DecryptLanes(DecKey, in + blocks * 16, out + blocks * 16, chain, 1);
+    }
+}
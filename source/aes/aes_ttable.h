@@ -0,0 +1,30 @@
+#ifndef _AES_TTABLE_H_
+#define _AES_TTABLE_H_
+
+#include "aes.h"
+
+// The number of CBC blocks decrypted together. Broadway has too few
+// registers to benefit from more than 4.
+#ifdef HW_RVL
+#define AES_INTERLEAVE 4
+#else
+#define AES_INTERLEAVE 8
+#endif
+
+// Derives the T-table encryption and decryption key schedules from an
+// already expanded, byte-oriented RoundKey.
+void AES_ttable_key_setup(uint32_t *EncKey, uint32_t *DecKey,
+                          const uint8_t *RoundKey);
+
+// Encrypts or decrypts a single AES_BLOCKLEN block in place.
+void AES_ttable_encrypt(const uint32_t *EncKey, uint8_t *block);
+void AES_ttable_decrypt(const uint32_t *DecKey, uint8_t *block);
+
+// CBC decrypts blocks from in to out, chaining from iv. As blocks are
+// independent of one another, AES_INTERLEAVE are decrypted at a time.
+// in and out may be identical, but must not otherwise overlap.
+void AES_ttable_cbc_decrypt(const uint32_t *DecKey, const uint8_t *in,
+                            uint8_t *out, const uint8_t *iv,
+                            uint32_t blocks);
+
+#endif // _AES_TTABLE_H_
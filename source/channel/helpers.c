@@ -25,6 +25,7 @@ s32 CreateParentDirs(char *path) {
         char *occurrence = strchr(path + offset, '/');
         if (occurrence == NULL) {
             // We've come to the end of our run.
+            free(currentDir);
             return 0;
         }
 
@@ -45,6 +46,7 @@ s32 CreateParentDirs(char *path) {
         if (status < 0 && status != ISFS_EEXIST) {
             printf("Failed to create directory at %s (error %d)\n", currentDir,
                    status);
+            free(currentDir);
             return status;
         }
 
@@ -116,3 +118,29 @@ void *ISFS_GetFile(const char *path, u32 *size) {
 
     return buf;
 }
+
+// ISFS_ReadFile reads exactly length bytes of a file into buf,
+// which must be 32-byte aligned. It returns false otherwise.
+bool ISFS_ReadFile(const char *path, void *buf, u32 length) {
+    s32 fd = ISFS_Open(path, ISFS_OPEN_READ);
+    if (fd < 0) {
+        return false;
+    }
+
+    memset(&stats, 0, sizeof(fstats));
+    s32 ret = ISFS_GetFileStats(fd, &stats);
+    if (ret < 0 || stats.file_length != length) {
+        ISFS_Close(fd);
+        return false;
+    }
+
+    ret = ISFS_Read(fd, buf, length);
+    ISFS_Close(fd);
+    if (ret != (s32)length) {
+        printf("ISFS_ReadFile: only able to read %d out of %d bytes!\n", ret,
+               length);
+        return false;
+    }
+
+    return true;
+}
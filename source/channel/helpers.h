@@ -1,2 +1,3 @@
 s32 CreateParentDirs(char *path);
 void *ISFS_GetFile(const char *path, u32 *size);
+bool ISFS_ReadFile(const char *path, void *buf, u32 length);
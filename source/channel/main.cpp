@@ -16,6 +16,7 @@ extern "C" {
 #include "noto_sans_jp_regular_otf.h"
 
 // PD related
+#include "pd_data.h"
 #include "pd_info.h"
 
 #define TITLE_ID(x, y) (((u64)(x) << 32) | (y))
@@ -66,12 +67,11 @@ int main(void) {
     InitFreeType((u8 *)noto_sans_jp_regular_otf, noto_sans_jp_regular_otf_size);
     InitGUIThreads();
 
-    /*u32 deviceId;
-    s32 ret = ES_GetDeviceID(&deviceId);
-    if (ret != 0) {
-        printf("Failed to obtain device ID.\n");
+    // Derive pd.dat's key once, reusing it for every load and save.
+    if (!PD_StartCryptoSession()) {
+        sleep(5);
         ExitApp(exitType);
-    }*/
+    }
 
     bool result = PD_PopulateData();
     if (!result) {
@@ -18,7 +18,7 @@
 // 48 KiB was chosen after many days of testing.
 // It horrifies the author.
 #define GUI_STACK_SIZE 48 * 1024
-#define _(string) gettext (string)
+#define _(string) gettext_hashed(string, GETTEXT_HASH(string))
 
 static GuiImageData *pointer[4];
 static GuiImage *bgImg = NULL;
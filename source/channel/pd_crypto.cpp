@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "pd_crypto.h"
+#include "pd_data.h"
+
+#ifdef HW_RVL
+#include <gccore.h>
+#include <ogc/lwp_watchdog.h>
+#else
+#include <time.h>
+#endif
+
+static struct PDCryptoStats PDStats;
+
+void PD_InitCryptoSession(struct PDCryptoSession *session, uint32_t deviceId) {
+    session->deviceId = deviceId;
+
+    // Copy 1:1. We're not going to bother with string terminators
+    // as we know our exact value ahead of time.
+    memcpy(session->key, &PERSONAL_DATA_KEY, 32);
+    memcpy(session->iv, &PERSONAL_DATA_IV, 16);
+
+    unsigned char firstByte = (unsigned char)deviceId;
+    unsigned char secondByte = (deviceId >> 8);
+    unsigned char thirdByte = (deviceId >> 16);
+    unsigned char fourthByte = (deviceId >> 24);
+
+    // We need to update values within the key based off of the device's ID.
+    session->key[7] = fourthByte;
+    session->key[15] = thirdByte;
+    session->key[23] = secondByte;
+    session->key[31] = firstByte;
+
+    // Similarly for the IV - its last 4 bytes are the device's ID as-is.
+    session->iv[12] = fourthByte;
+    session->iv[13] = thirdByte;
+    session->iv[14] = secondByte;
+    session->iv[15] = firstByte;
+
+    AES_init_ctx_iv(&session->ctx, session->key, session->iv);
+}
+
+static uint64_t PD_Microseconds() {
+#ifdef HW_RVL
+    return ticks_to_microsecs(gettime());
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+// PD_CountJob adds a job started at start to our statistics.
+static void PD_CountJob(uint32_t length, uint64_t start) {
+    PDStats.jobs++;
+    PDStats.bytes += length;
+    PDStats.microseconds += PD_Microseconds() - start;
+}
+
+bool PD_CryptoEncrypt(const struct PDCryptoSession *session,
+                      const unsigned char *iv, const void *in, void *out,
+                      uint32_t length) {
+    uint64_t start = PD_Microseconds();
+
+    // Reuse the session's expanded round keys, only replacing the IV.
+    struct AES_ctx ctx = session->ctx;
+    AES_ctx_set_iv(&ctx, iv);
+
+    memmove(out, in, length);
+    AES_CBC_encrypt_buffer(&ctx, (uint8_t *)out, length);
+
+    PD_CountJob(length, start);
+    return true;
+}
+
+bool PD_CryptoDecrypt(const struct PDCryptoSession *session,
+                      const unsigned char *iv, const void *in, void *out,
+                      uint32_t length) {
+    uint64_t start = PD_Microseconds();
+
+    // Reuse the session's expanded round keys, only replacing the IV.
+    struct AES_ctx ctx = session->ctx;
+    AES_ctx_set_iv(&ctx, iv);
+
+    if (in == out) {
+        AES_CBC_decrypt_buffer(&ctx, (uint8_t *)out, length);
+    } else {
+        AES_CBC_decrypt_range(&ctx, (const uint8_t *)in, (uint8_t *)out, 0,
+                              length);
+    }
+
+    PD_CountJob(length, start);
+    return true;
+}
+
+const struct PDCryptoStats *PD_GetCryptoStats() { return &PDStats; }
+
+void PD_ResetCryptoStats() { memset(&PDStats, 0, sizeof(PDStats)); }
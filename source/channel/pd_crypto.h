@@ -0,0 +1,42 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+extern "C" {
+#include <aes/aes.h>
+}
+
+// pd.dat is encrypted in software. IOS's AES engine only accepts 128-bit
+// keys, whereas pd.dat uses AES-256.
+
+// Statistics for all jobs, reset only by PD_ResetCryptoStats.
+struct PDCryptoStats {
+    uint32_t jobs;
+    uint32_t bytes;
+    uint64_t microseconds;
+};
+
+// PDCryptoSession holds everything derived from the console's device ID,
+// so that it need only be derived once.
+struct PDCryptoSession {
+    uint32_t deviceId;
+    unsigned char key[32];
+    unsigned char iv[16];
+    // Round keys for both directions, expanded from key.
+    struct AES_ctx ctx;
+};
+
+void PD_InitCryptoSession(struct PDCryptoSession *session, uint32_t deviceId);
+
+// Each performs AES-CBC over length bytes from in to out, which may be
+// identical. They return false should they be unable to.
+bool PD_CryptoEncrypt(const struct PDCryptoSession *session,
+                      const unsigned char *iv, const void *in, void *out,
+                      uint32_t length);
+bool PD_CryptoDecrypt(const struct PDCryptoSession *session,
+                      const unsigned char *iv, const void *in, void *out,
+                      uint32_t length);
+
+const struct PDCryptoStats *PD_GetCryptoStats();
+void PD_ResetCryptoStats();
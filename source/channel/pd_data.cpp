@@ -1,8 +1,10 @@
 #include <gccore.h>
 #include <malloc.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "pd_crypto.h"
 #include "pd_data.h"
 #include "pd_decrypted_dat.h"
 
@@ -13,94 +15,181 @@ extern "C" {
 #include "region.h"
 }
 
-// Keep two static variables in order to retain state.
+// Keep static variables in order to retain state.
 static void *PDFilePointer = NULL;
 
-struct KeyInfo *PD_GetKeyData() {
-    struct KeyInfo *info = new KeyInfo();
+// The encrypted contents of pd.dat as last read from or written to NAND.
+// This is NULL if pd.dat did not previously exist.
+static void *PDCipherPointer = NULL;
 
+#define PD_CBC_BLOCK_COUNT (PD_FILE_LENGTH / AES_BLOCKLEN)
+
+// The first CBC block modified since pd.dat was last written.
+// Every block from this point on must be re-encrypted.
+static u32 PDDirtyBlock = PD_CBC_BLOCK_COUNT;
+
+// Which CBC blocks within PDFilePointer have been decrypted thus far.
+// Blocks are only decrypted once something asks for them.
+static u8 PDDecryptedBlocks[PD_CBC_BLOCK_COUNT / 8];
+
+static bool PD_IsBlockDecrypted(u32 block) {
+    return PDDecryptedBlocks[block / 8] & (1 << (block % 8));
+}
+
+static void PD_MarkBlocksDecrypted(u32 start, u32 end) {
+    for (u32 block = start; block < end; block++) {
+        PDDecryptedBlocks[block / 8] |= 1 << (block % 8);
+    }
+}
+
+// pd.dat's plaintext and ciphertext each occupy a buffer from this pool.
+// They are 32-byte aligned, allowing ISFS to read and write them directly.
+#define PD_BUFFER_POOL_SIZE 2
+static u8 PDBufferPool[PD_BUFFER_POOL_SIZE][PD_FILE_LENGTH] ATTRIBUTE_ALIGN(32);
+static bool PDBufferInUse[PD_BUFFER_POOL_SIZE];
+static struct PDBufferStats PDBufferStats;
+
+static void *PD_AcquireBuffer() {
+    PDBufferStats.acquired++;
+
+    for (int i = 0; i < PD_BUFFER_POOL_SIZE; i++) {
+        if (!PDBufferInUse[i]) {
+            PDBufferInUse[i] = true;
+            return PDBufferPool[i];
+        }
+    }
+
+    // This should not happen, but remain functional if it does.
+    PDBufferStats.heapAllocations++;
+    void *buffer = aligned_alloc(32, PD_FILE_LENGTH);
+    if (buffer == NULL) {
+        printf("aligned_alloc() for a pd.dat buffer failed.\n");
+    }
+    return buffer;
+}
+
+static void PD_ReleaseBuffer(void *buffer) {
+    if (buffer == NULL) {
+        return;
+    }
+
+    PDBufferStats.released++;
+
+    for (int i = 0; i < PD_BUFFER_POOL_SIZE; i++) {
+        if (buffer == PDBufferPool[i]) {
+            PDBufferInUse[i] = false;
+            return;
+        }
+    }
+
+    free(buffer);
+}
+
+const struct PDBufferStats *PD_GetBufferStats() { return &PDBufferStats; }
+
+// Derived once from the console's device ID, and reused thereafter.
+static struct PDCryptoSession PDSession;
+static bool PDSessionStarted = false;
+
+// PD_StartCryptoSession derives our key, IV and round keys.
+// It should be called once at startup.
+bool PD_StartCryptoSession() {
     u32 deviceId;
     s32 ret = ES_GetDeviceID(&deviceId);
     if (ret != 0) {
         printf("Failed to obtain device ID.\n");
-        return NULL;
+        return false;
     }
 
-    // Copy 1:1. We're not going to bother with string terminators
-    // as we know our exact value ahead of time.
-    memcpy(info->key, &PERSONAL_DATA_KEY, 32);
-    memcpy(info->iv, &PERSONAL_DATA_IV, 16);
-
-    unsigned char firstByte = (unsigned char)deviceId;
-    unsigned char secondByte = (deviceId >> 8);
-    unsigned char thirdByte = (deviceId >> 16);
-    unsigned char fourthByte = (deviceId >> 24);
-
-    // We need to update values within the key based off of the device's ID.
-    info->key[7] = fourthByte;
-    info->key[15] = thirdByte;
-    info->key[23] = secondByte;
-    info->key[31] = firstByte;
+    PD_InitCryptoSession(&PDSession, deviceId);
+    PDSessionStarted = true;
+    return true;
+}
 
-    // Similarly for the IV - its last 4 bytes are the device's ID as-is.
-    info->iv[12] = fourthByte;
-    info->iv[13] = thirdByte;
-    info->iv[14] = secondByte;
-    info->iv[15] = firstByte;
+static const struct PDCryptoSession *PD_GetCryptoSession() {
+    if (!PDSessionStarted && !PD_StartCryptoSession()) {
+        return NULL;
+    }
 
-    return info;
+    return &PDSession;
 }
 
 void *PD_EncryptFile(void *fileBuffer) {
-    struct KeyInfo *keyInfo = PD_GetKeyData();
-    if (keyInfo == NULL) {
+    const struct PDCryptoSession *session = PD_GetCryptoSession();
+    if (session == NULL) {
         return NULL;
     }
 
-    void *encryptBuffer = malloc(PD_FILE_LENGTH);
-    if (fileBuffer == NULL) {
-        printf("malloc() for encryptBuffer failed.\n");
+    void *encryptBuffer = PD_AcquireBuffer();
+    if (encryptBuffer == NULL) {
         return NULL;
     }
-    memcpy(encryptBuffer, fileBuffer, PD_FILE_LENGTH);
-
-    struct AES_ctx ctx;
-    AES_init_ctx_iv(&ctx, keyInfo->key, keyInfo->iv);
 
     // Encrypt file.
-    AES_CBC_encrypt_buffer(&ctx, (uint8_t *)encryptBuffer, PD_FILE_LENGTH);
-
-    free(keyInfo);
+    bool success =
+        PD_CryptoEncrypt(session, session->iv, fileBuffer, encryptBuffer,
+                         PD_FILE_LENGTH);
+    if (!success) {
+        PD_ReleaseBuffer(encryptBuffer);
+        return NULL;
+    }
     return encryptBuffer;
 }
 
-void *PD_DecryptFile(void *fileBuffer) {
-    struct KeyInfo *keyInfo = PD_GetKeyData();
-    if (keyInfo == NULL) {
-        return NULL;
+bool PD_DecryptRanges(const void *cipherBuffer, void *plainBuffer,
+                      const struct PDRange *ranges, size_t count) {
+    const struct PDCryptoSession *session = PD_GetCryptoSession();
+    if (session == NULL) {
+        return false;
     }
 
-    void *decryptBuffer = malloc(PD_FILE_LENGTH);
-    if (fileBuffer == NULL) {
-        printf("malloc() for decryptBuffer failed.\n");
-        return NULL;
+    const unsigned char *cipher = (const unsigned char *)cipherBuffer;
+    unsigned char *plain = (unsigned char *)plainBuffer;
+    bool success = true;
+
+    for (size_t i = 0; i < count && success; i++) {
+        // Expand to the blocks covering this range.
+        u32 start = ranges[i].offset & ~(AES_BLOCKLEN - 1);
+        u32 end = (ranges[i].offset + ranges[i].length + AES_BLOCKLEN - 1) &
+                  ~(AES_BLOCKLEN - 1);
+        if (end > PD_FILE_LENGTH) {
+            end = PD_FILE_LENGTH;
+        }
+        if (start >= end) {
+            continue;
+        }
+
+        // Each block chains from the ciphertext preceding it.
+        const unsigned char *iv =
+            start != 0 ? cipher + start - AES_BLOCKLEN : session->iv;
+        success = PD_CryptoDecrypt(session, iv, cipher + start, plain + start,
+                                   end - start);
     }
-    memcpy(decryptBuffer, fileBuffer, PD_FILE_LENGTH);
 
-    struct AES_ctx ctx;
-    AES_init_ctx_iv(&ctx, keyInfo->key, keyInfo->iv);
+    return success;
+}
 
-    // Decrypt file.
-    AES_CBC_decrypt_buffer(&ctx, (uint8_t *)decryptBuffer, PD_FILE_LENGTH);
+// PD_EncryptFrom re-encrypts plaintext from offset onwards into the
+// matching position of cipherBuffer. All ciphertext prior to offset
+// is assumed current, as the block before offset serves as our IV.
+bool PD_EncryptFrom(const void *plainBuffer, void *cipherBuffer, u32 offset) {
+    const struct PDCryptoSession *session = PD_GetCryptoSession();
+    if (session == NULL) {
+        return false;
+    }
+
+    unsigned char *cipher = (unsigned char *)cipherBuffer;
+    const unsigned char *iv =
+        offset != 0 ? cipher + offset - AES_BLOCKLEN : session->iv;
 
-    free(keyInfo);
-    return decryptBuffer;
+    return PD_CryptoEncrypt(session, iv,
+                            (const unsigned char *)plainBuffer + offset,
+                            cipher + offset, PD_FILE_LENGTH - offset);
 }
 
 void *PD_GetTemplateData() {
-    void *fileBuffer = malloc(PD_FILE_LENGTH);
+    void *fileBuffer = PD_AcquireBuffer();
     if (fileBuffer == NULL) {
-        printf("malloc() for fileBuffer failed.\n");
         return NULL;
     }
 
@@ -116,11 +205,14 @@ void *PD_ReadFromNAND() {
         return NULL;
     }
 
-    u32 readSize;
-    void *fileBuffer = ISFS_GetFile(filepath, &readSize);
+    void *fileBuffer = PD_AcquireBuffer();
+    if (fileBuffer == NULL) {
+        return NULL;
+    }
 
-    // Perhaps the file was not written properly?
-    if (readSize != PD_FILE_LENGTH) {
+    // Perhaps the file does not exist, or was not written properly?
+    if (!ISFS_ReadFile(filepath, fileBuffer, PD_FILE_LENGTH)) {
+        PD_ReleaseBuffer(fileBuffer);
         return NULL;
     }
 
@@ -164,45 +256,206 @@ bool PD_WriteToNAND(void *fileBuffer) {
     return true;
 }
 
-// PD_LoadFileContents is guaranteed to
+// PD_WriteRangeToNAND overwrites part of an existing pd.dat in place.
+bool PD_WriteRangeToNAND(void *fileBuffer, u32 offset, u32 length) {
+    char *filepath = PD_GetDataPath();
+    if (filepath == NULL) {
+        printf("This console's region is not supported!\n");
+        return false;
+    }
+
+    s32 fd = ISFS_Open(filepath, ISFS_OPEN_WRITE);
+    if (fd < 0) {
+        printf("Error opening file at %s\n", filepath);
+        return false;
+    }
+
+    s32 ret = ISFS_Seek(fd, offset, SEEK_SET);
+    if (ret < 0) {
+        printf("Error seeking file at %s\n", filepath);
+        ISFS_Close(fd);
+        return false;
+    }
+
+    ret = ISFS_Write(fd, (unsigned char *)fileBuffer + offset, length);
+    if (ret != (s32)length) {
+        printf("Error writing file at %s\n", filepath);
+        ISFS_Close(fd);
+        return false;
+    }
+
+    ret = ISFS_Close(fd);
+    if (ret < 0) {
+        printf("Error closing file at %s\n", filepath);
+        return false;
+    }
+
+    return true;
+}
+
+// PD_LoadFileContents reads pd.dat without decrypting it, falling back to
+// our already decrypted template should pd.dat not exist.
 void *PD_LoadFileContents() {
     // Attempt to read what may already exist.
     void *fileBuffer = PD_ReadFromNAND();
     if (fileBuffer != NULL) {
-        // Decrypt file.
-        void *result = PD_DecryptFile(fileBuffer);
-
-        // Free original.
-        free(fileBuffer);
-
+        void *result = PD_AcquireBuffer();
+        if (result == NULL) {
+            PD_ReleaseBuffer(fileBuffer);
+            return NULL;
+        }
+
+        // Retain the original in order to decrypt on demand, and to
+        // only re-encrypt what changes.
+        PDCipherPointer = fileBuffer;
+        memset(PDDecryptedBlocks, 0, sizeof(PDDecryptedBlocks));
         return result;
     } else {
         // Default to using our decrypted template data.
+        PD_MarkBlocksDecrypted(0, PD_CBC_BLOCK_COUNT);
         return PD_GetTemplateData();
     }
 }
 
-// PD_GetFileContents may use an already decrypted version if available.
-// Otherwise, it will default to loading file contents.
-void *PD_GetFileContents() {
+// PD_GetFileRanges loads pd.dat if necessary, and ensures the given ranges
+// are decrypted. Other areas of the returned buffer may not be.
+void *PD_GetFileRanges(const struct PDRange *ranges, size_t count) {
     // Check if we've previously loaded pd.dat.
-    if (PDFilePointer != NULL) {
-        return PDFilePointer;
+    if (PDFilePointer == NULL) {
+        PDFilePointer = PD_LoadFileContents();
+        if (PDFilePointer == NULL) {
+            return NULL;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (ranges[i].length == 0) {
+            continue;
+        }
+
+        u32 end = (ranges[i].offset + ranges[i].length + AES_BLOCKLEN - 1) /
+                  AES_BLOCKLEN;
+        if (end > PD_CBC_BLOCK_COUNT) {
+            end = PD_CBC_BLOCK_COUNT;
+        }
+
+        // Decrypt each run of blocks we have yet to.
+        u32 block = ranges[i].offset / AES_BLOCKLEN;
+        while (block < end) {
+            if (PD_IsBlockDecrypted(block)) {
+                block++;
+                continue;
+            }
+
+            u32 runEnd = block;
+            while (runEnd < end && !PD_IsBlockDecrypted(runEnd)) {
+                runEnd++;
+            }
+
+            struct PDRange run = {block * AES_BLOCKLEN,
+                                  (runEnd - block) * AES_BLOCKLEN};
+            if (!PD_DecryptRanges(PDCipherPointer, PDFilePointer, &run, 1)) {
+                return NULL;
+            }
+
+            PD_MarkBlocksDecrypted(block, runEnd);
+            block = runEnd;
+        }
     }
 
-    // Load a new copy.
-    PDFilePointer = PD_LoadFileContents();
     return PDFilePointer;
 }
 
+// PD_GetFileContents returns the entirety of pd.dat decrypted,
+// loading it if necessary.
+void *PD_GetFileContents() {
+    struct PDRange all = {0, PD_FILE_LENGTH};
+    return PD_GetFileRanges(&all, 1);
+}
+
+// PD_UpdateFileContents copies length bytes into pd.dat at the given offset,
+// noting the first block changed for the next save.
+void PD_UpdateFileContents(uint32_t offset, const void *data,
+                           uint32_t length) {
+    struct PDRange range = {offset, length};
+    unsigned char *filePointer =
+        (unsigned char *)PD_GetFileRanges(&range, 1);
+    if (filePointer == NULL || length == 0) {
+        return;
+    }
+
+    // There is no need to re-encrypt if nothing has changed.
+    if (memcmp(filePointer + offset, data, length) == 0) {
+        return;
+    }
+    memcpy(filePointer + offset, data, length);
+
+    u32 block = offset / AES_BLOCKLEN;
+    if (block < PDDirtyBlock) {
+        PDDirtyBlock = block;
+    }
+}
+
 // PD_SaveFileContents encrypts and writes the current PDFilePointer to NAND.
+// If we have previously read or written pd.dat, only blocks from the first
+// modified onwards are re-encrypted and written.
 bool PD_SaveFileContents() {
     // Ensure we have a pd.dat loaded to work with.
     if (PDFilePointer == NULL) {
-        return NULL;
+        return false;
     }
 
-    void *fileBuffer = PD_EncryptFile(PDFilePointer);
-    bool success = PD_WriteToNAND(fileBuffer);
-    return success;
+    if (PDCipherPointer == NULL) {
+        void *fileBuffer = PD_EncryptFile(PDFilePointer);
+        if (fileBuffer == NULL) {
+            return false;
+        }
+
+        bool success = PD_WriteToNAND(fileBuffer);
+        if (!success) {
+            PD_ReleaseBuffer(fileBuffer);
+            return false;
+        }
+
+        PDCipherPointer = fileBuffer;
+        PDDirtyBlock = PD_CBC_BLOCK_COUNT;
+        return true;
+    }
+
+    u32 offset = PDDirtyBlock * AES_BLOCKLEN;
+    if (offset >= PD_FILE_LENGTH) {
+        // Nothing has changed since our last write.
+        return true;
+    }
+
+    // Everything we are about to re-encrypt must first be decrypted.
+    struct PDRange range = {offset, PD_FILE_LENGTH - offset};
+    if (PD_GetFileRanges(&range, 1) == NULL) {
+        return false;
+    }
+
+    if (!PD_EncryptFrom(PDFilePointer, PDCipherPointer, offset)) {
+        return false;
+    }
+
+    // ISFS requires 32-byte alignment for its buffers.
+    u32 writeOffset = offset & ~31;
+    bool success = PD_WriteRangeToNAND(PDCipherPointer, writeOffset,
+                                       PD_FILE_LENGTH - writeOffset);
+    if (!success) {
+        // We can no longer trust our cache to match NAND.
+        // Rewrite the file in full next time. Blocks not yet decrypted
+        // exist only as ciphertext, so decrypt them before dropping it.
+        if (PD_GetFileContents() != NULL) {
+            PD_ReleaseBuffer(PDCipherPointer);
+            PDCipherPointer = NULL;
+        } else {
+            // Otherwise, keep it and re-encrypt every block instead.
+            PDDirtyBlock = 0;
+        }
+        return false;
+    }
+
+    PDDirtyBlock = PD_CBC_BLOCK_COUNT;
+    return true;
 }
@@ -1,4 +1,6 @@
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #define PD_FILE_LENGTH 0x4000
 
 // Replace every ending null byte in a set of 8 with a byte
@@ -22,11 +24,28 @@ static const unsigned char PERSONAL_DATA_IV[16] = {
 // File magic (PDFF in ASCII) and 0x02 as the file's version.
 static const unsigned char EXPECTED_FILE_MAGIC[] = "PDFF\x02";
 
-// Used to house key info when loading.
-struct KeyInfo {
-    unsigned char key[32];
-    unsigned char iv[16];
+// A range of bytes within pd.dat.
+struct PDRange {
+    uint32_t offset;
+    uint32_t length;
 };
 
+// Counts of pd.dat buffers handed out by our pool. Once pd.dat has been
+// loaded and saved, these should no longer change.
+struct PDBufferStats {
+    uint32_t acquired;
+    uint32_t released;
+    // Buffers allocated because the pool was exhausted.
+    uint32_t heapAllocations;
+};
+
+const struct PDBufferStats *PD_GetBufferStats();
+
+bool PD_StartCryptoSession();
+bool PD_DecryptRanges(const void *cipherBuffer, void *plainBuffer,
+                      const struct PDRange *ranges, size_t count);
+void *PD_GetFileRanges(const struct PDRange *ranges, size_t count);
 void *PD_GetFileContents();
+void PD_UpdateFileContents(uint32_t offset, const void *data,
+                           uint32_t length);
 bool PD_SaveFileContents();
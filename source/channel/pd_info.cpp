@@ -1,10 +1,10 @@
 // We need gettime from LWP to match OSGetTime.
-#include <codecvt>
 #include <iomanip>
 #include <iostream>
 #include <kaitai/kaitaistream.h>
 #include <ogc/lwp_watchdog.h>
 #include <pd-kaitai-struct/pd.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include <string>
@@ -15,155 +15,199 @@ extern "C" {
 
 #include "pd_data.h"
 #include "pd_info.h"
+#include "pd_utf16.h"
+#include "pd_view.h"
 
 struct PDInfoData currentData = {};
 
-std::string *WcharToStringPipeline(const wchar_t *convertee, size_t expected) {
-    std::wstring_convert<std::codecvt_utf16<wchar_t>, wchar_t> convert;
-
-    // wchar_t* -> std::string*
-    std::string *intermediate = new std::string(convert.to_bytes(convertee));
-
-    // Resize to full
-    intermediate->resize(expected);
+// Each string within PDInfoData and the pd.dat field it is stored within,
+// in file order. Both reading and writing iterate over this.
+struct PDFieldBinding {
+    pd_field_id_t field;
+    size_t member;
+    size_t capacity;
+};
+
+#define PD_BIND(id, member)                                                    \
+    {id, offsetof(PDInfoData, member),                                         \
+     sizeof(PDInfoData::member) / sizeof(wchar_t)}
+
+static const struct PDFieldBinding PD_BINDINGS[] = {
+    PD_BIND(PD_FIELD_INFO_SURNAME, user_last_name),
+    PD_BIND(PD_FIELD_INFO_FIRST_NAME, user_first_name),
+    PD_BIND(PD_FIELD_INFO_POSTAL_CODE, user_zip_code),
+    PD_BIND(PD_FIELD_INFO_CITY, user_city),
+    PD_BIND(PD_FIELD_INFO_HOME_ADDRESS, user_home_address),
+    PD_BIND(PD_FIELD_INFO_PHONE_NUMBER, user_phone_number),
+    PD_BIND(PD_FIELD_INFO_EMAIL_ADDRESS, user_email_address),
+};
+
+#define PD_BINDING_COUNT (sizeof(PD_BINDINGS) / sizeof(*PD_BINDINGS))
+#define PD_PIN_LENGTH (sizeof(PDInfoData::user_pin) / sizeof(wchar_t))
+
+// Every field must fit within its PDInfoData counterpart.
+#define PD_ASSERT_FITS(id, member)                                             \
+    static_assert(PD_FIELDS[id].length / 2 <=                                  \
+                      sizeof(PDInfoData::member) / sizeof(wchar_t),            \
+                  #member " cannot hold its pd.dat field")
+PD_ASSERT_FITS(PD_FIELD_INFO_SURNAME, user_last_name);
+PD_ASSERT_FITS(PD_FIELD_INFO_FIRST_NAME, user_first_name);
+PD_ASSERT_FITS(PD_FIELD_INFO_POSTAL_CODE, user_zip_code);
+PD_ASSERT_FITS(PD_FIELD_INFO_CITY, user_city);
+PD_ASSERT_FITS(PD_FIELD_INFO_HOME_ADDRESS, user_home_address);
+PD_ASSERT_FITS(PD_FIELD_INFO_PHONE_NUMBER, user_phone_number);
+PD_ASSERT_FITS(PD_FIELD_INFO_EMAIL_ADDRESS, user_email_address);
+PD_ASSERT_FITS(PD_FIELD_PIN_BLOCK_PIN, user_pin);
+
+static wchar_t *PD_BindingMember(struct PDInfoData *data,
+                                 const struct PDFieldBinding &binding) {
+    return (wchar_t *)((unsigned char *)data + binding.member);
+}
 
-    return intermediate;
+// The longest string field, sizing our buffer for encoding.
+static constexpr size_t PD_Max(size_t a, size_t b) { return a > b ? a : b; }
+static constexpr size_t PD_LongestString(size_t i = 0) {
+    return i == PD_FIELD_COUNT
+               ? 0
+               : PD_Max(PD_FIELDS[i].encoding == PD_ENCODING_UTF16BE
+                            ? PD_FIELDS[i].length
+                            : 0,
+                        PD_LongestString(i + 1));
 }
 
-const wchar_t *StringToWcharPipeline(std::string convertee) {
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
+// PD_ValidateWithKaitai parses pd.dat via the generated Kaitai Struct.
+// It is considerably slower than PDView, but reports exactly which
+// field failed validation.
+bool PD_ValidateWithKaitai(const void *pdLocation) {
+#ifdef KS_NO_EXCEPTIONS
+    // Parse decrypted contents in place.
+    kaitai::kstream ks(pdLocation, PD_FILE_LENGTH);
+
+    pd_t data(&ks);
+    const kaitai::parse_status &status = data._status();
+    if (!status.ok()) {
+        std::cout << "Failed to parse pd.dat." << std::endl;
+        std::cout << status.path() << ": " << status.message() << std::endl;
+        return false;
+    }
+#else
+    try {
+        // Parse decrypted contents in place.
+        kaitai::kstream ks(pdLocation, PD_FILE_LENGTH);
 
-    // std::string -> std::wstring
-    std::wstring *intermediate =
-        new std::wstring(convert.from_bytes(convertee));
+        pd_t data(&ks);
+    } catch (const std::exception &e) {
+        std::cout << "A C++ exception occurred." << std::endl;
+        std::cout << e.what() << std::endl;
+        return false;
+    }
+#endif
 
-    // std::wstring -> wchar_t*
-    return intermediate->c_str();
+    return true;
 }
 
 bool PD_PopulateData() {
-    void *pdLocation = PD_GetFileContents();
+    // Only decrypt what pd.ksy describes. The remainder of the INFO block
+    // is padding we have no need to look at.
+    struct PDRange ranges[PD_FIELD_COUNT];
+    for (size_t i = 0; i < PD_FIELD_COUNT; i++) {
+        ranges[i].offset = PD_FIELDS[i].offset;
+        ranges[i].length = PD_FIELDS[i].length;
+    }
+
+    void *pdLocation = PD_GetFileRanges(ranges, PD_FIELD_COUNT);
     if (pdLocation == NULL) {
         std::cout << "Unable to read pd.dat!" << std::endl;
         return false;
     }
 
-    try {
-        // Load decrypted contents into stream
-        std::stringstream is;
-        is.write((const char *)pdLocation, 0x4000);
-        kaitai::kstream ks(&is);
-
-        // Attempt to parse via the provided Kaitai Struct
-        pd_t data(&ks);
-        pd_t::info_block_t *infoBlock = data.info();
-        pd_t::pin_block_t *pinBlock = data.pin_block();
-
-        // First we will detect if the pd.dat is password protected
-        if (pinBlock->pin_magic() != std::string("\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 12)) {
-            currentData.passwordProtected = true;
-            const wchar_t *pin = StringToWcharPipeline(pinBlock->pin());
-            wcsncpy(currentData.user_pin, pin, 8);
-        } else
-            currentData.passwordProtected = false;
-
-        // Convert current data from pd.dat
-        const wchar_t *first_name =
-            StringToWcharPipeline(infoBlock->first_name());
-        const wchar_t *last_name = StringToWcharPipeline(infoBlock->surname());
-        const wchar_t *email_address =
-            StringToWcharPipeline(infoBlock->email_address());
-        const wchar_t *home_address =
-            StringToWcharPipeline(infoBlock->home_address());
-        const wchar_t *city = StringToWcharPipeline(infoBlock->city());
-        const wchar_t *phone_number = StringToWcharPipeline(infoBlock->phone_number());
-        const wchar_t *zip_code = StringToWcharPipeline(infoBlock->postal_code());
-
-        // Populate data
-        wcsncpy(currentData.user_first_name, first_name, 32);
-        wcsncpy(currentData.user_last_name, last_name, 32);
-        wcsncpy(currentData.user_email_address, email_address, 128);
-        wcsncpy(currentData.user_home_address, home_address, 128);
-        wcsncpy(currentData.user_city, city, 32);
-        wcsncpy(currentData.user_phone_number, phone_number, 32);
-        wcsncpy(currentData.user_zip_code, zip_code, 34);
-    } catch (const std::exception &e) {
-        std::cout << "A C++ exception occurred." << std::endl;
-        std::cout << e.what() << std::endl;
+    // Read fields in place. Should anything look off, defer to the
+    // Kaitai Struct in order to explain why.
+    PDView view(pdLocation);
+    if (!view.IsValid()) {
+        PD_ValidateWithKaitai(PD_GetFileContents());
         return false;
     }
 
+    // First we will detect if the pd.dat is password protected
+    if (view.IsPasswordProtected()) {
+        currentData.passwordProtected = true;
+        view.ReadString(PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN], currentData.user_pin,
+                        PD_PIN_LENGTH);
+    } else
+        currentData.passwordProtected = false;
+
+    // Populate data
+    for (size_t i = 0; i < PD_BINDING_COUNT; i++) {
+        const struct PDFieldBinding &binding = PD_BINDINGS[i];
+        view.ReadString(PD_FIELDS[binding.field],
+                        PD_BindingMember(&currentData, binding),
+                        binding.capacity);
+    }
+
     return true;
 }
 
 bool PD_WriteData() {
-    void *pdLocation = PD_GetFileContents();
+    // Fields are decrypted as they are updated.
+    void *pdLocation = PD_GetFileRanges(NULL, 0);
     if (pdLocation == NULL) {
         std::cout << "Unable to read pd.dat!" << std::endl;
         return false;
     }
 
-    try {
-        // All string lengths must be twice such due to being UTF-16 BE.
-        std::string *first_name =
-            WcharToStringPipeline(currentData.user_first_name, 32 * 2);
-        std::string *last_name =
-            WcharToStringPipeline(currentData.user_last_name, 32 * 2);
-        std::string *email_address =
-            WcharToStringPipeline(currentData.user_email_address, 128 * 2);
-        std::string *home_address =
-            WcharToStringPipeline(currentData.user_home_address, 128 * 2);
-        std::string *city =
-            WcharToStringPipeline(currentData.user_city, 32 * 2);
-        std::string *phone_number = WcharToStringPipeline(currentData.user_phone_number, 32 * 2);
-        std::string *zip = WcharToStringPipeline(currentData.user_zip_code, 17 * 2);
-
-        // We specify specific offsets within the file.
-        // TODO: Replace with Kaitai serialization?
-        void *filePointer = PD_GetFileContents();
-
-        memcpy(filePointer + 335, zip->c_str(), zip->length());
-        // Update first name
-        // INFO block
-        memcpy(filePointer + 207, last_name->c_str(), last_name->length());
-        // KANA block
-        memcpy(filePointer + 9723, last_name->c_str(), last_name->length());
-
-        // Update last name
-        // INFO block
-        memcpy(filePointer + 271, first_name->c_str(), first_name->length());
-        // KANA block
-        memcpy(filePointer + 9787, first_name->c_str(), first_name->length());
-
-        // Update email
-        memcpy(filePointer + 1075, email_address->c_str(),
-               email_address->length());
-
-        // Update home address
-        memcpy(filePointer + 499, home_address->c_str(),
-               home_address->length());
-
-        // Update city
-        memcpy(filePointer + 435, city->c_str(), city->length());
-
-        // Update phone number
-        memcpy(filePointer + 1011, phone_number->c_str(), phone_number->length());
-
-        // Update PIN if needed
-        if (currentData.passwordProtected) {
-            memcpy(filePointer + 5,
-                   "\x01\x00\x95\xCE\x9C\xA4\x7A\x3E\x37\x00\x00\x00", 12);
-            std::string *pin = WcharToStringPipeline(currentData.user_pin, 4 * 2);
-            memcpy(filePointer + 25, pin->c_str(), pin->length());
-        }
-        else
-            memcpy(filePointer + 5, "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 12);
+    unsigned char value[PD_LongestString()];
 
-        return PD_SaveFileContents();
-    } catch (const std::exception &e) {
-        std::cout << "A C++ exception occurred." << std::endl;
-        std::cout << e.what() << std::endl;
+    // Characters beyond the BMP take two UTF-16 units, so a full member may
+    // not fit its field. Refuse to save rather than write part of it.
+    for (size_t i = 0; i < PD_BINDING_COUNT; i++) {
+        const struct PDFieldBinding &binding = PD_BINDINGS[i];
+        const pd_field_t &field = PD_FIELDS[binding.field];
+
+        if (!PD_EncodeUTF16BE(PD_BindingMember(&currentData, binding),
+                              binding.capacity, value, field.length)) {
+            std::cout << field.name << " is too long for pd.dat!" << std::endl;
+            return false;
+        }
+    }
+    const pd_field_t &pinField = PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN];
+    if (currentData.passwordProtected &&
+        !PD_EncodeUTF16BE(currentData.user_pin, PD_PIN_LENGTH, value,
+                          pinField.length)) {
+        std::cout << pinField.name << " is too long for pd.dat!" << std::endl;
         return false;
     }
-    return true;
+
+    for (size_t i = 0; i < PD_BINDING_COUNT; i++) {
+        const struct PDFieldBinding &binding = PD_BINDINGS[i];
+        const pd_field_t &field = PD_FIELDS[binding.field];
+
+        PD_EncodeUTF16BE(PD_BindingMember(&currentData, binding),
+                         binding.capacity, value, field.length);
+        PD_UpdateFileContents(field.offset, value, field.length);
+
+        // Names are additionally present within the KANA block.
+        if (field.kana_offset != 0) {
+            PD_UpdateFileContents(field.kana_offset, value, field.length);
+        }
+    }
+
+    // Update PIN if needed
+    const pd_field_t &pinMagic = PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN_MAGIC];
+    if (currentData.passwordProtected) {
+        PD_UpdateFileContents(
+            pinMagic.offset,
+            "\x01\x00\x95\xCE\x9C\xA4\x7A\x3E\x37\x00\x00\x00",
+            pinMagic.length);
+
+        PD_EncodeUTF16BE(currentData.user_pin, PD_PIN_LENGTH, value,
+                         pinField.length);
+        PD_UpdateFileContents(pinField.offset, value, pinField.length);
+    } else
+        PD_UpdateFileContents(
+            pinMagic.offset,
+            "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+            pinMagic.length);
+
+    return PD_SaveFileContents();
 }
@@ -0,0 +1,221 @@
+#pragma once
+#include <pd-kaitai-struct/pd_fields.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "pd_utf16.h"
+
+// PDLayout parses and serializes pd.dat at compile time, from the same
+// generated table PDView reads. Every field's offset, length and encoding
+// is a template constant, so each field's code is emitted inline with
+// nothing left to look up. Fixed contents such as "PDFF\x02" become a
+// single integer comparison.
+//
+// Only what pd.ksy describes is touched: padding between fields is
+// neither read nor written.
+
+// PD_PackContents folds up to 8 bytes of a literal into a big-endian
+// integer at compile time.
+static constexpr uint64_t PD_PackContents(const char *contents, size_t length,
+                                          uint64_t value = 0) {
+    return length == 0
+               ? value
+               : PD_PackContents(contents + 1, length - 1,
+                                 (value << 8) | (unsigned char)*contents);
+}
+
+static inline uint64_t PD_LoadBE(const unsigned char *data, size_t length) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < length; i++) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+static inline void PD_StoreBE(unsigned char *data, size_t length,
+                              uint64_t value) {
+    for (size_t i = length; i > 0; i--) {
+        data[i - 1] = (unsigned char)value;
+        value >>= 8;
+    }
+}
+
+// PDCodec implements a single encoding of the given length. Contents is
+// the packed expected value of PD_ENCODING_CONTENTS fields.
+template <pd_encoding_t Encoding, size_t Length, uint64_t Contents>
+struct PDCodec;
+
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_CONTENTS, Length, Contents> {
+    static_assert(Length <= 8, "contents must fit within a comparison");
+
+    struct Value {};
+
+    static bool Parse(const unsigned char *data, Value &) {
+        return PD_LoadBE(data, Length) == Contents;
+    }
+
+    static bool Serialize(const Value &, unsigned char *data) {
+        PD_StoreBE(data, Length, Contents);
+        return true;
+    }
+};
+
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_BYTES, Length, Contents> {
+    struct Value {
+        unsigned char bytes[Length];
+    };
+
+    static bool Parse(const unsigned char *data, Value &value) {
+        memcpy(value.bytes, data, Length);
+        return true;
+    }
+
+    static bool Serialize(const Value &value, unsigned char *data) {
+        memcpy(data, value.bytes, Length);
+        return true;
+    }
+};
+
+// Integers share a single implementation, differing only in their type.
+template <typename Type, size_t Length> struct PDIntegerCodec {
+    static_assert(Length == sizeof(Type), "integer length mismatch");
+
+    typedef Type Value;
+
+    static bool Parse(const unsigned char *data, Value &value) {
+        value = (Type)PD_LoadBE(data, Length);
+        return true;
+    }
+
+    static bool Serialize(const Value &value, unsigned char *data) {
+        PD_StoreBE(data, Length, value);
+        return true;
+    }
+};
+
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_U1, Length, Contents>
+    : PDIntegerCodec<uint8_t, Length> {};
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_U2BE, Length, Contents>
+    : PDIntegerCodec<uint16_t, Length> {};
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_U4BE, Length, Contents>
+    : PDIntegerCodec<uint32_t, Length> {};
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_U8BE, Length, Contents>
+    : PDIntegerCodec<uint64_t, Length> {};
+
+template <size_t Length, uint64_t Contents>
+struct PDCodec<PD_ENCODING_UTF16BE, Length, Contents> {
+    // Strings are always null terminated, even when filling their field.
+    struct Value {
+        wchar_t text[Length / 2 + 1];
+    };
+
+    static bool Parse(const unsigned char *data, Value &value) {
+        PD_DecodeUTF16BE(data, Length, value.text, Length / 2);
+        value.text[Length / 2] = L'\0';
+        return true;
+    }
+
+    static bool Serialize(const Value &value, unsigned char *data) {
+        return PD_EncodeUTF16BE(value.text, Length / 2 + 1, data, Length);
+    }
+};
+
+// PDField binds a field of PD_FIELDS to its codec.
+template <size_t Id> struct PDField {
+    static_assert(Id < PD_FIELD_COUNT, "no such field");
+
+    typedef PDCodec<PD_FIELDS[Id].encoding, PD_FIELDS[Id].length,
+                    PD_FIELDS[Id].contents != nullptr
+                        ? PD_PackContents(PD_FIELDS[Id].contents,
+                                          PD_FIELDS[Id].length)
+                        : 0>
+        Codec;
+    typedef typename Codec::Value Value;
+
+    // pd.ksy's only condition reads the PIN if its magic is set.
+    static bool IsPresent(const unsigned char *data) {
+        if (!PD_FIELDS[Id].conditional) {
+            return true;
+        }
+        const pd_field_t &magic = PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN_MAGIC];
+        for (size_t i = 0; i < magic.length; i++) {
+            if (data[magic.offset + i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Absent fields are parsed as zeroes, but are serialized regardless.
+    static bool Parse(const unsigned char *data, Value &value) {
+        if (!IsPresent(data)) {
+            memset(&value, 0, sizeof(value));
+            return true;
+        }
+        return Codec::Parse(data + PD_FIELDS[Id].offset, value);
+    }
+
+    static bool Serialize(const Value &value, unsigned char *data) {
+        return Codec::Serialize(value, data + PD_FIELDS[Id].offset);
+    }
+};
+
+// PDRecordFields stores the value of every field from Id onwards.
+template <size_t Id> struct PDRecordFields : PDRecordFields<Id + 1> {
+    typename PDField<Id>::Value value;
+};
+
+template <> struct PDRecordFields<PD_FIELD_COUNT> {};
+
+// PDRecord holds every field of pd.dat, decoded.
+struct PDRecord : PDRecordFields<0> {
+    template <size_t Id> typename PDField<Id>::Value &Get() {
+        return static_cast<PDRecordFields<Id> &>(*this).value;
+    }
+
+    template <size_t Id> const typename PDField<Id>::Value &Get() const {
+        return static_cast<const PDRecordFields<Id> &>(*this).value;
+    }
+};
+
+// PDLayout walks fields from Id onwards, unrolled by recursion.
+template <size_t Id = 0> struct PDLayout {
+    // Parse decodes every field, returning false upon the first
+    // mismatching contents.
+    static bool Parse(const unsigned char *data, PDRecord &record) {
+        return PDField<Id>::Parse(data, record.Get<Id>()) &&
+               PDLayout<Id + 1>::Parse(data, record);
+    }
+
+    // Serialize encodes every field, returning false if a string was
+    // truncated to fit. Every field is written regardless.
+    static bool Serialize(const PDRecord &record, unsigned char *data) {
+        bool fits = PDField<Id>::Serialize(record.Get<Id>(), data);
+        return PDLayout<Id + 1>::Serialize(record, data) && fits;
+    }
+
+    // IsValid compares every fixed value without decoding anything else.
+    static bool IsValid(const unsigned char *data) {
+        if (PD_FIELDS[Id].encoding == PD_ENCODING_CONTENTS) {
+            typename PDField<Id>::Value unused;
+            if (!PDField<Id>::Parse(data, unused)) {
+                return false;
+            }
+        }
+        return PDLayout<Id + 1>::IsValid(data);
+    }
+};
+
+template <> struct PDLayout<PD_FIELD_COUNT> {
+    static bool Parse(const unsigned char *, PDRecord &) { return true; }
+    static bool Serialize(const PDRecord &, unsigned char *) { return true; }
+    static bool IsValid(const unsigned char *) { return true; }
+};
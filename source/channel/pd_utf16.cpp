@@ -0,0 +1,87 @@
+#include "pd_utf16.h"
+
+#define PD_IS_HIGH_SURROGATE(c) ((c) >= 0xD800 && (c) <= 0xDBFF)
+#define PD_IS_LOW_SURROGATE(c) ((c) >= 0xDC00 && (c) <= 0xDFFF)
+
+size_t PD_DecodeUTF16BE(const unsigned char *source, size_t length,
+                        wchar_t *output, size_t outputLength) {
+    size_t units = length / 2;
+    size_t unit = 0;
+    size_t count = 0;
+
+    while (unit < units && count < outputLength) {
+        unsigned int c = (source[unit * 2] << 8) | source[unit * 2 + 1];
+        if (c == 0) {
+            break;
+        }
+        unit++;
+
+#if WCHAR_MAX > 0xFFFF
+        // Combine surrogate pairs should wchar_t be able to hold the result.
+        if (PD_IS_HIGH_SURROGATE(c) && unit < units) {
+            unsigned int low = (source[unit * 2] << 8) | source[unit * 2 + 1];
+            if (PD_IS_LOW_SURROGATE(low)) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                unit++;
+            }
+        }
+#endif
+
+        output[count++] = (wchar_t)c;
+    }
+
+    // Similar to wcsncpy, pad the remainder with null characters.
+    for (size_t i = count; i < outputLength; i++) {
+        output[i] = 0;
+    }
+
+    return count;
+}
+
+static inline void PD_PutUnit(unsigned char *output, unsigned int unit) {
+    output[0] = (unsigned char)(unit >> 8);
+    output[1] = (unsigned char)unit;
+}
+
+bool PD_EncodeUTF16BE(const wchar_t *input, size_t inputLength,
+                      unsigned char *output, size_t length) {
+    size_t units = length / 2;
+    size_t unit = 0;
+    bool truncated = false;
+
+    for (size_t i = 0; i < inputLength && input[i] != 0; i++) {
+        unsigned long c = (unsigned long)input[i];
+
+        if (c > 0xFFFF) {
+            if (c > 0x10FFFF) {
+                c = 0xFFFD;
+            } else {
+                // Never split a pair should only one half fit.
+                if (unit + 2 > units) {
+                    truncated = true;
+                    break;
+                }
+
+                c -= 0x10000;
+                PD_PutUnit(output + unit * 2, 0xD800 | (c >> 10));
+                PD_PutUnit(output + unit * 2 + 2, 0xDC00 | (c & 0x3FF));
+                unit += 2;
+                continue;
+            }
+        }
+
+        if (unit + 1 > units) {
+            truncated = true;
+            break;
+        }
+
+        PD_PutUnit(output + unit * 2, c);
+        unit++;
+    }
+
+    for (size_t i = unit * 2; i < length; i++) {
+        output[i] = 0;
+    }
+
+    return !truncated;
+}
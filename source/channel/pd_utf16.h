@@ -0,0 +1,20 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <wchar.h>
+
+// pd.dat stores strings as fixed-length, null-padded UTF-16BE fields.
+// These convert between such fields and wchar_t in a single pass,
+// without allocating. Characters beyond the BMP become surrogate pairs.
+
+// PD_DecodeUTF16BE reads up to the first null within length bytes of
+// source, following the semantics of wcsncpy for output. It returns the
+// number of characters decoded. Unpaired surrogates are kept as-is.
+size_t PD_DecodeUTF16BE(const unsigned char *source, size_t length,
+                        wchar_t *output, size_t outputLength);
+
+// PD_EncodeUTF16BE writes input, up to its first null or inputLength
+// characters, into exactly length bytes of output, padding with nulls.
+// It returns false if input had to be truncated to fit.
+bool PD_EncodeUTF16BE(const wchar_t *input, size_t inputLength,
+                      unsigned char *output, size_t length);
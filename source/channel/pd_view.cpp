@@ -0,0 +1,21 @@
+#include "pd_layout.h"
+#include "pd_utf16.h"
+#include "pd_view.h"
+
+bool PDView::IsValid() const { return PDLayout<>::IsValid(data); }
+
+bool PDView::IsPasswordProtected() const {
+    const pd_field_t &magic = PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN_MAGIC];
+    for (size_t i = 0; i < magic.length; i++) {
+        if (data[magic.offset + i] != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PDView::ReadString(const pd_field_t &field, wchar_t *output,
+                        size_t outputLength) const {
+    PD_DecodeUTF16BE(data + field.offset, field.length, output, outputLength);
+}
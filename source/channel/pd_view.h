@@ -0,0 +1,29 @@
+#pragma once
+#include <pd-kaitai-struct/pd_fields.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+// PDView reads fields directly out of a decrypted pd.dat buffer.
+// It neither copies nor allocates; the buffer must outlive the view.
+class PDView {
+  public:
+    PDView(const void *buffer) : data((const unsigned char *)buffer) {}
+
+    // IsValid checks every fixed value described by pd.ksy.
+    // It does not report which one failed - use pd_t for that.
+    bool IsValid() const;
+
+    // IsPasswordProtected mirrors pd.ksy's condition for reading a PIN.
+    bool IsPasswordProtected() const;
+
+    // ReadString converts the given UTF-16BE field into output,
+    // following the semantics of wcsncpy.
+    void ReadString(const pd_field_t &field, wchar_t *output,
+                    size_t outputLength) const;
+
+    const unsigned char *At(size_t offset) const { return data + offset; }
+
+  private:
+    const unsigned char *data;
+};
@@ -14,11 +14,16 @@ char *PD_GetDataPath() {
     // /title/00010008/4843434a/data/nocopy/pd.dat\0 is 44 characters.
     char *path = "/title/00010008/4843434a/data/nocopy/pd.dat";
 
-    // Ensure this path exists.
-    s32 ret = CreateParentDirs(path);
-    if (ret < 0) {
-        printf("Failed while creating parent directories (error %d)\n", ret);
-        return NULL;
+    // Ensure this path exists. Once it does, there is no need to check again.
+    static bool parentsCreated = false;
+    if (!parentsCreated) {
+        s32 ret = CreateParentDirs(path);
+        if (ret < 0) {
+            printf("Failed while creating parent directories (error %d)\n",
+                   ret);
+            return NULL;
+        }
+        parentsCreated = true;
     }
 
     return path;
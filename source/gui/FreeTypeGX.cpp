@@ -28,6 +28,8 @@ static FT_GlyphSlot
     ftSlot; /**< FreeType reusable FT_GlyphSlot glyph container object. */
 
 FreeTypeGX *fontSystem[MAX_FONT_SIZE + 1];
+static uint8_t fontTextureFormat[MAX_FONT_SIZE + 1]; /**< Glyph texture format
+                                                        of each font size. */
 
 void InitFreeType(uint8_t *fontBuffer, FT_Long bufferSize) {
     FT_Init_FreeType(&ftLibrary);
@@ -37,6 +39,9 @@ void InitFreeType(uint8_t *fontBuffer, FT_Long bufferSize) {
 
     for (int i = 0; i < 50; i++)
         fontSystem[i] = NULL;
+
+    for (int i = 0; i <= MAX_FONT_SIZE; i++)
+        fontTextureFormat[i] = GX_TF_I8;
 }
 
 void DeinitFreeType() {
@@ -49,6 +54,34 @@ void ChangeFontSize(FT_UInt pixelSize) {
     FT_Set_Pixel_Sizes(ftFace, 0, pixelSize);
 }
 
+/**
+ * Selects the glyph texture format of a font size.
+ *
+ * Glyphs only carry coverage, so GX_TF_I8 keeps it exactly in a byte per
+ * pixel, the default. GX_TF_I4 keeps 16 levels in half of that, while
+ * GX_TF_IA4 and GX_TF_RGBA8 are offered for compatibility. The format applies
+ * to font sizes created after InitFreeType and this call, so call
+ * ClearFontData to convert those already drawn.
+ *
+ * @param pixelSize	The font size to set.
+ * @param textureFormat	GX_TF_I4, GX_TF_I8, GX_TF_IA4 or GX_TF_RGBA8.
+ */
+void SetFontTextureFormat(FT_UInt pixelSize, uint8_t textureFormat) {
+    if (pixelSize > MAX_FONT_SIZE)
+        return;
+
+    switch (textureFormat) {
+    case GX_TF_I4:
+    case GX_TF_I8:
+    case GX_TF_IA4:
+    case GX_TF_RGBA8:
+        fontTextureFormat[pixelSize] = textureFormat;
+        break;
+    default:
+        break;
+    }
+}
+
 void ClearFontData() {
     for (int i = 0; i < 50; i++) {
         if (fontSystem[i])
@@ -99,6 +132,8 @@ FreeTypeGX::FreeTypeGX(FT_UInt pixelSize, uint8_t vertexIndex) {
                                FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_NONE);
     this->ftPointSize = pixelSize;
     this->ftKerningEnabled = FT_HAS_KERNING(ftFace);
+    this->textureFormat = fontTextureFormat[pixelSize];
+    this->glyphMemory = 0;
 }
 
 /**
@@ -204,17 +239,26 @@ void FreeTypeGX::unloadFont() {
          i != iEnd; ++i)
         free(i->second.glyphDataTexture);
     this->fontData.clear();
+    this->glyphMemory = 0;
 }
 
-uint16_t FreeTypeGX::adjustTextureWidth(uint16_t textureWidth) {
-    uint16_t alignment = 4;
+/**
+ * Pads a glyph's width to whole tiles of its texture format.
+ */
+uint16_t FreeTypeGX::adjustTextureWidth(uint16_t textureWidth,
+                                        uint8_t textureFormat) {
+    uint16_t alignment = textureFormat == GX_TF_RGBA8 ? 4 : 8;
     return textureWidth % alignment == 0
                ? textureWidth
                : alignment + textureWidth - (textureWidth % alignment);
 }
 
-uint16_t FreeTypeGX::adjustTextureHeight(uint16_t textureHeight) {
-    uint16_t alignment = 4;
+/**
+ * Pads a glyph's height to whole tiles of its texture format.
+ */
+uint16_t FreeTypeGX::adjustTextureHeight(uint16_t textureHeight,
+                                         uint8_t textureFormat) {
+    uint16_t alignment = textureFormat == GX_TF_I4 ? 8 : 4;
     return textureHeight % alignment == 0
                ? textureHeight
                : alignment + textureHeight - (textureHeight % alignment);
@@ -239,8 +283,10 @@ ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode) {
         if (ftSlot->format == FT_GLYPH_FORMAT_BITMAP) {
             FT_Bitmap *glyphBitmap = &ftSlot->bitmap;
 
-            textureWidth = adjustTextureWidth(glyphBitmap->width);
-            textureHeight = adjustTextureHeight(glyphBitmap->rows);
+            textureWidth =
+                adjustTextureWidth(glyphBitmap->width, this->textureFormat);
+            textureHeight =
+                adjustTextureHeight(glyphBitmap->rows, this->textureFormat);
 
             this->fontData[charCode] = (ftgxCharData){
                 (int16_t)ftSlot->bitmap_left,
@@ -283,9 +329,11 @@ uint16_t FreeTypeGX::cacheGlyphDataComplete() {
 /**
  * Loads the rendered bitmap into the relevant structure's data buffer.
  *
- * This routine does a simple byte-wise copy of the glyph's rendered 8-bit
- * grayscale bitmap into the structure's buffer. Each byte is converted from the
- * bitmap's intensity value into the a uint32_t RGBA value.
+ * This routine swizzles the glyph's rendered 8-bit grayscale bitmap into the
+ * tiles of the instance's texture format. As the color is taken from the
+ * vertices, only the coverage is kept: as is within GX_TF_I8 tiles of 8x4,
+ * rounded to 4 bits within GX_TF_I4 tiles of 8x8 or the alpha of GX_TF_IA4
+ * tiles of 8x4, and within every channel of GX_TF_RGBA8 tiles of 4x4.
  *
  * @param bmp	A pointer to the most recently rendered glyph's bitmap.
  * @param charData	A pointer to an allocated ftgxCharData structure whose
@@ -294,7 +342,11 @@ uint16_t FreeTypeGX::cacheGlyphDataComplete() {
  * Optimized for RGBA8 use by Dimok.
  */
 void FreeTypeGX::loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData) {
-    int length = charData->textureWidth * charData->textureHeight * 4;
+    int length = charData->textureWidth * charData->textureHeight;
+    if (this->textureFormat == GX_TF_I4)
+        length >>= 1;
+    else if (this->textureFormat == GX_TF_RGBA8)
+        length <<= 2;
 
     uint8_t *glyphData = (uint8_t *)memalign(32, length);
     if (!glyphData)
@@ -303,24 +355,47 @@ void FreeTypeGX::loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData) {
     memset(glyphData, 0x00, length);
 
     uint8_t *src = (uint8_t *)bmp->buffer;
+    uint32_t tilesX = charData->textureWidth >> 3;
     uint32_t offset;
 
     for (uint32_t imagePosY = 0; imagePosY < bmp->rows; ++imagePosY) {
         for (uint32_t imagePosX = 0; imagePosX < bmp->width; ++imagePosX) {
-            offset = ((((imagePosY >> 2) * (charData->textureWidth >> 2) +
-                        (imagePosX >> 2))
-                       << 5) +
-                      ((imagePosY & 3) << 2) + (imagePosX & 3))
-                     << 1;
-            glyphData[offset] = *src;
-            glyphData[offset + 1] = *src;
-            glyphData[offset + 32] = *src;
-            glyphData[offset + 33] = *src;
+            switch (this->textureFormat) {
+            case GX_TF_I4:
+                offset = (((imagePosY >> 3) * tilesX + (imagePosX >> 3)) << 5) +
+                         ((imagePosY & 7) << 2) + ((imagePosX & 7) >> 1);
+                // Expanded by the GPU as v * 17, so round to the nearest.
+                glyphData[offset] |= ((*src + 8) / 17)
+                                     << (imagePosX & 1 ? 0 : 4);
+                break;
+            case GX_TF_IA4:
+                offset = (((imagePosY >> 2) * tilesX + (imagePosX >> 3)) << 5) +
+                         ((imagePosY & 3) << 3) + (imagePosX & 7);
+                glyphData[offset] = ((*src + 8) / 17) << 4 | 0x0f;
+                break;
+            case GX_TF_RGBA8:
+                offset = ((((imagePosY >> 2) * (charData->textureWidth >> 2) +
+                            (imagePosX >> 2))
+                           << 5) +
+                          ((imagePosY & 3) << 2) + (imagePosX & 3))
+                         << 1;
+                glyphData[offset] = *src;
+                glyphData[offset + 1] = *src;
+                glyphData[offset + 32] = *src;
+                glyphData[offset + 33] = *src;
+                break;
+            default:
+                offset = (((imagePosY >> 2) * tilesX + (imagePosX >> 3)) << 5) +
+                         ((imagePosY & 3) << 3) + (imagePosX & 7);
+                glyphData[offset] = *src;
+                break;
+            }
             ++src;
         }
     }
     DCFlushRange(glyphData, length);
     charData->glyphDataTexture = (uint32_t *)glyphData;
+    this->glyphMemory += length;
 }
 
 /**
@@ -433,7 +508,7 @@ uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t *text,
 
             GX_InitTexObj(&glyphTexture, glyphData->glyphDataTexture,
                           glyphData->textureWidth, glyphData->textureHeight,
-                          GX_TF_RGBA8, GX_CLAMP, GX_CLAMP, GX_FALSE);
+                          this->textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
             this->copyTextureToFramebuffer(
                 &glyphTexture, glyphData->textureWidth,
                 glyphData->textureHeight,
@@ -589,6 +664,13 @@ void FreeTypeGX::getOffset(wchar_t *text, ftgxDataOffset *offset) {
     offset->min = strMin;
 }
 
+/**
+ * Returns the memory held by the cached glyph textures.
+ *
+ * @return The size of every glyph texture of this font size, in bytes.
+ */
+uint32_t FreeTypeGX::getGlyphMemory() { return this->glyphMemory; }
+
 /**
  * Copies the supplied texture quad to the EFB.
  *
@@ -610,7 +692,15 @@ void FreeTypeGX::copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth,
     GX_LoadTexObj(texObj, GX_TEXMAP0);
     GX_InvalidateTexAll();
 
-    GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
+    // Color from the vertices, alpha from their alpha times the coverage.
+    GX_SetTevColorIn(GX_TEVSTAGE0, GX_CC_ZERO, GX_CC_ZERO, GX_CC_ZERO,
+                     GX_CC_RASC);
+    GX_SetTevAlphaIn(GX_TEVSTAGE0, GX_CA_ZERO, GX_CA_TEXA, GX_CA_RASA,
+                     GX_CA_ZERO);
+    GX_SetTevColorOp(GX_TEVSTAGE0, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1,
+                     GX_TRUE, GX_TEVPREV);
+    GX_SetTevAlphaOp(GX_TEVSTAGE0, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1,
+                     GX_TRUE, GX_TEVPREV);
     GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
 
     GX_Begin(GX_QUADS, this->vertexIndex, 4);
@@ -116,6 +116,7 @@ const GXColor ftgxWhite =
 void InitFreeType(uint8_t *fontBuffer, FT_Long bufferSize);
 void DeinitFreeType();
 void ChangeFontSize(FT_UInt pixelSize);
+void SetFontTextureFormat(FT_UInt pixelSize, uint8_t textureFormat);
 wchar_t *charToWideChar(const char *p);
 void ClearFontData();
 
@@ -137,14 +138,18 @@ class FreeTypeGX {
     bool ftKerningEnabled; /**< Flag indicating the availability of font kerning
                               data. */
     uint8_t vertexIndex;   /**< Vertex format descriptor index. */
+    uint8_t textureFormat; /**< Glyph texture format (GX_TF_*). */
+    uint32_t glyphMemory;  /**< Bytes held by the glyph textures. */
     uint32_t compatibilityMode; /**< Compatibility mode for default tev
                                    operations and vertex descriptors. */
     std::map<wchar_t, ftgxCharData>
         fontData; /**< Map which holds the glyph data structures for the
                      corresponding characters. */
 
-    static uint16_t adjustTextureWidth(uint16_t textureWidth);
-    static uint16_t adjustTextureHeight(uint16_t textureHeight);
+    static uint16_t adjustTextureWidth(uint16_t textureWidth,
+                                       uint8_t textureFormat);
+    static uint16_t adjustTextureHeight(uint16_t textureHeight,
+                                        uint8_t textureFormat);
 
     static int16_t getStyleOffsetWidth(uint16_t width, uint16_t format);
     static int16_t getStyleOffsetHeight(ftgxDataOffset *offset,
@@ -187,6 +192,8 @@ class FreeTypeGX {
     uint16_t getHeight(wchar_t const *text);
     void getOffset(wchar_t *text, ftgxDataOffset *offset);
     void getOffset(wchar_t const *text, ftgxDataOffset *offset);
+
+    uint32_t getGlyphMemory();
 };
 
 #endif /* FREETYPEGX_H_ */
@@ -1,264 +1,295 @@
-#include <gctypes.h>
-#include <gccore.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <unistd.h>
-
-#include "filelist.h"
-#include "gettext.h"
-
-typedef struct _MSG {
-    u32 id;
-    char *msgstr;
-    struct _MSG *next;
-} MSG;
-static MSG *baseMSG = 0;
-
-#define HASHWORDBITS 32
-
-// Gets the Wii's language and loads the corresponding lang file
-bool text_language() {
-    switch (CONF_GetLanguage()) {
-    case CONF_LANG_ENGLISH:
-        return LoadLanguage((char *)en_lang, en_lang_size);
-    case CONF_LANG_FRENCH:
-        return LoadLanguage((char *)fr_lang, fr_lang_size);
-    case CONF_LANG_SPANISH:
-        return LoadLanguage((char *)es_lang, es_lang_size);
-    case CONF_LANG_ITALIAN:
-        return LoadLanguage((char *)it_lang, it_lang_size);
-    case CONF_LANG_GERMAN:
-        return LoadLanguage((char *)de_lang, de_lang_size);
-    case CONF_LANG_DUTCH:
-        return LoadLanguage((char *)nl_lang, nl_lang_size);
-    default:
-        // Default to English
-        return LoadLanguage((char *)en_lang, en_lang_size);
-    }
-}
-
-/* Defines the so called `hashpjw' function by P.J. Weinberger
- [see Aho/Sethi/Ullman, COMPILERS: Principles, Techniques and Tools,
- 1986, 1987 Bell Telephone Laboratories, Inc.]  */
-static inline u32 hash_string(const char *str_param) {
-    u32 hval, g;
-    const char *str = str_param;
-
-    /* Compute the hash value for the given string.  */
-    hval = 0;
-    while (*str != '\0') {
-        hval <<= 4;
-        hval += (u8)*str++;
-        g = hval & ((u32)0xf << (HASHWORDBITS - 4));
-        if (g != 0) {
-            hval ^= g >> (HASHWORDBITS - 8);
-            hval ^= g;
-        }
-    }
-    return hval;
-}
-
-/* Expand some escape sequences found in the argument string.  */
-static char *expand_escape(const char *str) {
-    char *retval, *rp;
-    const char *cp = str;
-
-    retval = (char *)malloc(strlen(str) + 1);
-    if (retval == NULL)
-        return NULL;
-    rp = retval;
-
-    while (cp[0] != '\0' && cp[0] != '\\')
-        *rp++ = *cp++;
-    if (cp[0] == '\0')
-        goto terminate;
-    do {
-
-        /* Here cp[0] == '\\'.  */
-        switch (*++cp) {
-        case '\"': /* " */
-            *rp++ = '\"';
-            ++cp;
-            break;
-        case 'a': /* alert */
-            *rp++ = '\a';
-            ++cp;
-            break;
-        case 'b': /* backspace */
-            *rp++ = '\b';
-            ++cp;
-            break;
-        case 'f': /* form feed */
-            *rp++ = '\f';
-            ++cp;
-            break;
-        case 'n': /* new line */
-            *rp++ = '\n';
-            ++cp;
-            break;
-        case 'r': /* carriage return */
-            *rp++ = '\r';
-            ++cp;
-            break;
-        case 't': /* horizontal tab */
-            *rp++ = '\t';
-            ++cp;
-            break;
-        case 'v': /* vertical tab */
-            *rp++ = '\v';
-            ++cp;
-            break;
-        case '\\':
-            *rp = '\\';
-            ++cp;
-            break;
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7': {
-            int ch = *cp++ - '0';
-
-            if (*cp >= '0' && *cp <= '7') {
-                ch *= 8;
-                ch += *cp++ - '0';
-
-                if (*cp >= '0' && *cp <= '7') {
-                    ch *= 8;
-                    ch += *cp++ - '0';
-                }
-            }
-            *rp = ch;
-        } break;
-        default:
-            *rp = '\\';
-            break;
-        }
-
-        while (cp[0] != '\0' && cp[0] != '\\')
-            *rp++ = *cp++;
-    } while (cp[0] != '\0');
-
-/* Terminate string.  */
-terminate:
-    *rp = '\0';
-    return retval;
-}
-
-static MSG *findMSG(u32 id) {
-    MSG *msg;
-    for (msg = baseMSG; msg; msg = msg->next) {
-        if (msg->id == id)
-            return msg;
-    }
-    return NULL;
-}
-
-static MSG *setMSG(const char *msgid, const char *msgstr) {
-    u32 id = hash_string(msgid);
-    MSG *msg = findMSG(id);
-    if (!msg) {
-        msg = (MSG *)malloc(sizeof(MSG));
-        msg->id = id;
-        msg->msgstr = NULL;
-        msg->next = baseMSG;
-        baseMSG = msg;
-    }
-    if (msg) {
-        if (msgstr) {
-            if (msg->msgstr)
-                free(msg->msgstr);
-            msg->msgstr = expand_escape(msgstr);
-        }
-        return msg;
-    }
-    return NULL;
-}
-
-static void gettextCleanUp(void) {
-    while (baseMSG) {
-        MSG *nextMsg = baseMSG->next;
-        free(baseMSG->msgstr);
-        free(baseMSG);
-        baseMSG = nextMsg;
-    }
-}
-
-static char *memfgets(char *dst, int maxlen, char *src) {
-    if (!src || !dst || maxlen <= 0)
-        return NULL;
-
-    char *newline = strchr(src, '\n');
-
-    if (newline == NULL)
-        return NULL;
-
-    memcpy(dst, src, (newline - src));
-    dst[(newline - src)] = 0;
-    return ++newline;
-}
-
-bool LoadLanguage(char *language, size_t lang_size) {
-    char line[200];
-    char *lastID = NULL;
-
-    char *file, *eof;
-
-    file = language;
-    eof = file + lang_size;
-
-    gettextCleanUp();
-
-    while (file && file < eof) {
-        file = memfgets(line, sizeof(line), file);
-
-        if (!file)
-            break;
-
-        // lines starting with # are comments
-        if (line[0] == '#')
-            continue;
-
-        if (strncmp(line, "msgid \"", 7) == 0) {
-            char *msgid, *end;
-            if (lastID) {
-                free(lastID);
-                lastID = NULL;
-            }
-            msgid = &line[7];
-            end = strrchr(msgid, '"');
-            if (end && end - msgid > 1) {
-                *end = 0;
-                lastID = strdup(msgid);
-            }
-        } else if (strncmp(line, "msgstr \"", 8) == 0) {
-            char *msgstr, *end;
-
-            if (lastID == NULL)
-                continue;
-
-            msgstr = &line[8];
-            end = strrchr(msgstr, '"');
-            if (end && end - msgstr > 1) {
-                *end = 0;
-                setMSG(lastID, msgstr);
-            }
-            free(lastID);
-            lastID = NULL;
-        }
-    }
-    return true;
-}
-
-const char *gettext(const char *msgid) {
-    MSG *msg = findMSG(hash_string(msgid));
-
-    if (msg && msg->msgstr) {
-        return msg->msgstr;
-    }
-    return msgid;
-}
+#include <gctypes.h>
+#include <gccore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "filelist.h"
+#include "gettext.h"
+
+// Languages are binary catalogs compiled from data/i10n by
+// tools/langcat/langcat.py, which documents their layout. They are read in
+// place, so all offsets are from the start of the catalog.
+#define CATALOG_MAGIC 0x4C434154 // LCAT
+#define CATALOG_VERSION 1
+
+typedef struct _CATALOG {
+    u32 magic;
+    u32 version;
+    u32 slotShift;
+    u32 slotCount;
+    u32 size;
+} CATALOG;
+
+typedef struct _MSG {
+    u32 id;
+    u32 msgstr;
+    u32 wmsgstr;
+} MSG;
+
+static_assert(sizeof(wchar_t) == 4, "catalogs hold 32 bit wchar_t strings");
+
+static const u8 *catalog = NULL;
+static const MSG *msgTable = NULL;
+static u32 msgTableMask = 0;
+static u32 msgTableShift = 0;
+
+#define HASHWORDBITS 32
+
+// Gets the Wii's language and loads the corresponding lang file
+bool text_language() {
+    switch (CONF_GetLanguage()) {
+    case CONF_LANG_ENGLISH:
+        return LoadLanguage((char *)en_lang, en_lang_size);
+    case CONF_LANG_FRENCH:
+        return LoadLanguage((char *)fr_lang, fr_lang_size);
+    case CONF_LANG_SPANISH:
+        return LoadLanguage((char *)es_lang, es_lang_size);
+    case CONF_LANG_ITALIAN:
+        return LoadLanguage((char *)it_lang, it_lang_size);
+    case CONF_LANG_GERMAN:
+        return LoadLanguage((char *)de_lang, de_lang_size);
+    case CONF_LANG_DUTCH:
+        return LoadLanguage((char *)nl_lang, nl_lang_size);
+    default:
+        // Default to English
+        return LoadLanguage((char *)en_lang, en_lang_size);
+    }
+}
+
+/* Defines the so called `hashpjw' function by P.J. Weinberger
+ [see Aho/Sethi/Ullman, COMPILERS: Principles, Techniques and Tools,
+ 1986, 1987 Bell Telephone Laboratories, Inc.]  */
+static inline u32 hash_string(const char *str_param) {
+    u32 hval, g;
+    const char *str = str_param;
+
+    /* Compute the hash value for the given string.  */
+    hval = 0;
+    while (*str != '\0') {
+        hval <<= 4;
+        hval += (u8)*str++;
+        g = hval & ((u32)0xf << (HASHWORDBITS - 4));
+        if (g != 0) {
+            hval ^= g >> (HASHWORDBITS - 8);
+            hval ^= g;
+        }
+    }
+    return hval;
+}
+
+// As computed by tools/langcat/langcat.py.
+static_assert(gettext_hash("Choose Channel") == 109242220,
+              "gettext_hash must match the catalogs' hashpjw");
+
+// Returns the slot holding id, or NULL if it has none.
+static const MSG *findMSG(u32 id) {
+    if (!msgTable)
+        return NULL;
+    // Fibonacci hashing spreads hashpjw's low bits across the table.
+    u32 i = (id * 2654435761u) >> msgTableShift;
+    while (msgTable[i].msgstr) {
+        if (msgTable[i].id == id)
+            return &msgTable[i];
+        i = (i + 1) & msgTableMask;
+    }
+    return NULL;
+}
+
+// Interned wide text, see gettext.h. Entries are chained by msgid hash and
+// belong to the language they were translated under, while private entries
+// belong to none. Unreferenced entries are kept for the next screen to reuse,
+// until more than WTEXT_IDLE_MAX gather and all of them are freed. Elements
+// are built and destroyed by a single thread, so none of this is locked.
+#define WTEXT_BUCKETS 128
+#define WTEXT_BUCKET_SHIFT 25 // 32 - log2(WTEXT_BUCKETS)
+#define WTEXT_IDLE_MAX 256
+
+struct _WTEXT {
+    WTEXT *next;         // Next entry within the bucket
+    const wchar_t *text; // Into the catalog, or following the entry
+    const char *key;     // msgid, following the text, or NULL if private
+    u32 id;              // hashpjw of key
+    u32 generation;      // Language translated under, 0 if private
+    u32 refs;
+    u32 size; // Bytes allocated
+};
+
+static WTEXT *wtextTable[WTEXT_BUCKETS];
+static u32 wtextGeneration = 1;
+static WTEXT_STATS wtextStats;
+
+// Widens str as charToWideChar does, into strlen(str) + 1 characters.
+static void widen(wchar_t *dst, const char *str) {
+    int bt = mbstowcs(dst, str, strlen(str));
+    if (bt > 0) {
+        dst[bt] = (wchar_t)'\0';
+        return;
+    }
+    while ((*dst++ = *str++))
+        ;
+}
+
+// Allocates an entry followed by textLen characters and keyLen bytes.
+static WTEXT *allocWText(size_t textLen, size_t keyLen) {
+    size_t size = sizeof(WTEXT) + textLen * sizeof(wchar_t) + keyLen;
+    WTEXT *entry = (WTEXT *)malloc(size);
+    if (!entry)
+        return NULL;
+
+    entry->next = NULL;
+    entry->text = (const wchar_t *)(entry + 1);
+    entry->key = NULL;
+    entry->refs = 1;
+    entry->size = size;
+
+    wtextStats.entries++;
+    wtextStats.bytes += size;
+    wtextStats.allocations++;
+    return entry;
+}
+
+static void freeWText(WTEXT *entry) {
+    wtextStats.entries--;
+    wtextStats.bytes -= entry->size;
+    free(entry);
+}
+
+// Frees every unreferenced interned entry. If stale, all other entries are
+// unlinked too, to be freed once released.
+static void sweepWText(bool stale) {
+    for (int i = 0; i < WTEXT_BUCKETS; i++) {
+        WTEXT **link = &wtextTable[i];
+        while (*link) {
+            WTEXT *entry = *link;
+            if (entry->refs == 0) {
+                *link = entry->next;
+                freeWText(entry);
+            } else if (stale) {
+                *link = entry->next;
+                entry->next = NULL;
+            } else {
+                link = &entry->next;
+            }
+        }
+    }
+    wtextStats.idle = 0;
+}
+
+bool LoadLanguage(char *language, size_t lang_size) {
+    const CATALOG *header = (const CATALOG *)language;
+
+    catalog = NULL;
+    msgTable = NULL;
+
+    // Text translated under the previous language is no longer shared.
+    sweepWText(true);
+    if (++wtextGeneration == 0)
+        wtextGeneration = 1;
+
+    if (lang_size < sizeof(CATALOG) || header->magic != CATALOG_MAGIC ||
+        header->version != CATALOG_VERSION || header->size != lang_size ||
+        header->slotCount < 2 || header->slotCount & (header->slotCount - 1) ||
+        header->slotShift != 32 - (u32)__builtin_ctz(header->slotCount) ||
+        header->slotCount > (lang_size - sizeof(CATALOG)) / sizeof(MSG))
+        return false;
+
+    catalog = (const u8 *)language;
+    msgTable = (const MSG *)(catalog + sizeof(CATALOG));
+    msgTableMask = header->slotCount - 1;
+    msgTableShift = header->slotShift;
+    return true;
+}
+
+const char *gettext(const char *msgid) {
+    return gettext_hashed(msgid, hash_string(msgid));
+}
+
+const char *gettext_hashed(const char *msgid, u32 id) {
+    const MSG *msg = findMSG(id);
+
+    if (msg) {
+        return (const char *)(catalog + msg->msgstr);
+    }
+    return msgid;
+}
+
+const wchar_t *wgettext(const char *msgid) {
+    const MSG *msg = findMSG(hash_string(msgid));
+
+    if (msg) {
+        return (const wchar_t *)(catalog + msg->wmsgstr);
+    }
+    return NULL;
+}
+
+WTEXT *wtext_acquire(const char *msgid) {
+    u32 id = hash_string(msgid);
+    WTEXT **bucket = &wtextTable[(id * 2654435761u) >> WTEXT_BUCKET_SHIFT];
+
+    for (WTEXT *entry = *bucket; entry; entry = entry->next) {
+        if (entry->id == id && !strcmp(entry->key, msgid)) {
+            if (entry->refs++ == 0)
+                wtextStats.idle--;
+            wtextStats.hits++;
+            return entry;
+        }
+    }
+    wtextStats.misses++;
+
+    // Translations are already widened within the catalog.
+    const MSG *msg = findMSG(id);
+    size_t keyLen = strlen(msgid) + 1;
+    WTEXT *entry = allocWText(msg ? 0 : keyLen, keyLen);
+    if (!entry)
+        return NULL;
+
+    char *key = (char *)(entry->text + (msg ? 0 : keyLen));
+    memcpy(key, msgid, keyLen);
+    if (msg)
+        entry->text = (const wchar_t *)(catalog + msg->wmsgstr);
+    else
+        widen((wchar_t *)entry->text, msgid);
+
+    entry->key = key;
+    entry->id = id;
+    entry->generation = wtextGeneration;
+    entry->next = *bucket;
+    *bucket = entry;
+    return entry;
+}
+
+WTEXT *wtext_create(const wchar_t *text) {
+    size_t len = wcslen(text) + 1;
+    WTEXT *entry = allocWText(len, 0);
+    if (!entry)
+        return NULL;
+
+    wmemcpy((wchar_t *)entry->text, text, len);
+    entry->id = 0;
+    entry->generation = 0;
+    return entry;
+}
+
+void wtext_release(WTEXT *entry) {
+    if (!entry || --entry->refs)
+        return;
+
+    // Private and stale entries are no longer within the table.
+    if (entry->generation != wtextGeneration) {
+        freeWText(entry);
+        return;
+    }
+
+    if (++wtextStats.idle > WTEXT_IDLE_MAX)
+        sweepWText(false);
+}
+
+const wchar_t *wtext_string(const WTEXT *text) {
+    return text ? text->text : NULL;
+}
+
+const char *wtext_msgid(const WTEXT *text) { return text ? text->key : NULL; }
+
+void wtext_stats(WTEXT_STATS *stats) { *stats = wtextStats; }
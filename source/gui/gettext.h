@@ -1,15 +1,75 @@
-#ifndef _GETTEXT_H_
-#define _GETTEXT_H_
-
-#include <stdio.h>
-
-bool LoadLanguage(char *language, size_t lang_size);
-bool text_language();
-
-/*
- * input msg = a text in ASCII
- * output = the translated msg in utf-8
- */
-const char *gettext(const char *msg);
-
-#endif /* _GETTEXT_H_ */
+#ifndef _GETTEXT_H_
+#define _GETTEXT_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <type_traits>
+#include <wchar.h>
+
+bool LoadLanguage(char *language, size_t lang_size);
+bool text_language();
+
+/*
+ * input msg = a text in ASCII
+ * output = the translated msg in utf-8
+ */
+const char *gettext(const char *msg);
+
+/*
+ * hashpjw, as catalogs key their messages, usable at compile time.
+ */
+constexpr uint32_t gettext_hash_step(uint32_t hval) {
+    return hval ^ ((hval & 0xf0000000) >> 24) ^ (hval & 0xf0000000);
+}
+
+constexpr uint32_t gettext_hash(const char *msg, uint32_t hval = 0) {
+    return *msg ? gettext_hash(msg + 1,
+                               gettext_hash_step((hval << 4) + (uint8_t)*msg))
+                : hval;
+}
+
+/*
+ * As gettext, given the hash of msg. GETTEXT_HASH hashes literals while
+ * compiling.
+ */
+const char *gettext_hashed(const char *msg, uint32_t id);
+
+#define GETTEXT_HASH(msg)                                                      \
+    (std::integral_constant<uint32_t, gettext_hash(msg)>::value)
+
+/*
+ * input msg = a text in ASCII
+ * output = the translated msg, already widened, or NULL if untranslated
+ */
+const wchar_t *wgettext(const char *msg);
+
+/*
+ * Immutable wide text shared between GuiText elements. wtext_acquire interns
+ * the translation of msg under the current language, so every holder of msg
+ * shares one string, while wtext_create keeps a private copy of text that is
+ * not a msgid. Each handle returned must be given back to wtext_release.
+ * Loading a language invalidates the interned strings, which stay valid for
+ * their holders until released. Both return NULL when out of memory.
+ */
+typedef struct _WTEXT WTEXT;
+
+WTEXT *wtext_acquire(const char *msg);
+WTEXT *wtext_create(const wchar_t *text);
+void wtext_release(WTEXT *text);
+// The text of a handle, or NULL for a NULL handle
+const wchar_t *wtext_string(const WTEXT *text);
+// The msgid of a handle, or NULL for a NULL or private handle
+const char *wtext_msgid(const WTEXT *text);
+
+typedef struct _WTEXT_STATS {
+    uint32_t entries;     // Handles currently allocated
+    uint32_t idle;        // Interned handles kept without holders
+    uint32_t bytes;       // Memory held by all handles
+    uint32_t allocations; // Handles allocated since startup
+    uint32_t hits;        // Acquisitions served by an interned handle
+    uint32_t misses;      // Acquisitions that allocated a handle
+} WTEXT_STATS;
+
+void wtext_stats(WTEXT_STATS *stats);
+
+#endif /* _GETTEXT_H_ */
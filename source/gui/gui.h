@@ -45,6 +45,7 @@
 #include "FreeTypeGX.h"
 #include "audio.h"
 #include "filelist.h"
+#include "gettext.h"
 #include "input.h"
 #include "oggplayer.h"
 #include "pngu.h"
@@ -701,11 +702,11 @@ class GuiText : public GuiElement {
 
   protected:
     GXColor color;        //!< Font color
-    wchar_t *text;        //!< Translated Unicode text value
+    WTEXT *textRef;       //!< Shared handle of the text value
+    const wchar_t *text;  //!< Translated Unicode text value, held by textRef
     wchar_t *textDyn[20]; //!< Text value, if max width, scrolling, or wrapping
                           //!< enabled
     int textDynNum;       //!< Number of text lines
-    char *origText;       //!< Original text data (English)
     int size;             //!< Font size
     int maxWidth;      //!< Maximum width of the generated text object (for text
                        //!< wrapping)
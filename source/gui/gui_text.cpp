@@ -26,7 +26,7 @@ static u16 presetStyle = 0;
  * Constructor for the GuiText class.
  */
 GuiText::GuiText(const char *t, int s, GXColor c) {
-    origText = NULL;
+    textRef = NULL;
     text = NULL;
     size = s;
     color = c;
@@ -44,8 +44,8 @@ GuiText::GuiText(const char *t, int s, GXColor c) {
     alignmentVert = ALIGN_MIDDLE;
 
     if (t) {
-        origText = strdup(t);
-        text = charToWideChar(gettext(t));
+        textRef = wtext_acquire(t);
+        text = wtext_string(textRef);
     }
 
     for (int i = 0; i < 20; i++)
@@ -56,7 +56,7 @@ GuiText::GuiText(const char *t, int s, GXColor c) {
  * Constructor for the GuiText class, uses presets
  */
 GuiText::GuiText(const char *t) {
-    origText = NULL;
+    textRef = NULL;
     text = NULL;
     size = presetSize;
     color = presetColor;
@@ -74,8 +74,8 @@ GuiText::GuiText(const char *t) {
     alignmentVert = presetAlignmentVert;
 
     if (t) {
-        origText = strdup(t);
-        text = charToWideChar(gettext(t));
+        textRef = wtext_acquire(t);
+        text = wtext_string(textRef);
     }
 
     for (int i = 0; i < 20; i++)
@@ -86,10 +86,7 @@ GuiText::GuiText(const char *t) {
  * Destructor for the GuiText class.
  */
 GuiText::~GuiText() {
-    if (origText)
-        free(origText);
-    if (text)
-        delete[] text;
+    wtext_release(textRef);
 
     if (textDynNum > 0) {
         for (int i = 0; i < textDynNum; i++)
@@ -99,10 +96,9 @@ GuiText::~GuiText() {
 }
 
 void GuiText::SetText(const char *t) {
-    if (origText)
-        free(origText);
-    if (text)
-        delete[] text;
+    // Acquired first, so that setting the same text keeps its handle.
+    WTEXT *ref = t ? wtext_acquire(t) : NULL;
+    wtext_release(textRef);
 
     if (textDynNum > 0) {
         for (int i = 0; i < textDynNum; i++)
@@ -110,23 +106,16 @@ void GuiText::SetText(const char *t) {
                 delete[] textDyn[i];
     }
 
-    origText = NULL;
-    text = NULL;
+    textRef = ref;
+    text = wtext_string(textRef);
     textDynNum = 0;
     textScrollPos = 0;
     textScrollInitialDelay = TEXT_SCROLL_INITIAL_DELAY;
-
-    if (t) {
-        origText = strdup(t);
-        text = charToWideChar(gettext(t));
-    }
 }
 
 void GuiText::SetWText(wchar_t *t) {
-    if (origText)
-        free(origText);
-    if (text)
-        delete[] text;
+    WTEXT *ref = t ? wtext_create(t) : NULL;
+    wtext_release(textRef);
 
     if (textDynNum > 0) {
         for (int i = 0; i < textDynNum; i++)
@@ -134,14 +123,11 @@ void GuiText::SetWText(wchar_t *t) {
                 delete[] textDyn[i];
     }
 
-    origText = NULL;
-    text = NULL;
+    textRef = ref;
+    text = wtext_string(textRef);
     textDynNum = 0;
     textScrollPos = 0;
     textScrollInitialDelay = TEXT_SCROLL_INITIAL_DELAY;
-
-    if (t)
-        text = wcsdup(t);
 }
 
 int GuiText::GetLength() {
@@ -261,12 +247,15 @@ void GuiText::SetAlignment(int hor, int vert) {
 }
 
 void GuiText::ResetText() {
-    if (!origText)
+    const char *msgid = wtext_msgid(textRef);
+    if (!msgid)
         return;
-    if (text)
-        delete[] text;
 
-    text = charToWideChar(gettext(origText));
+    // The old handle holds msgid, so is released last.
+    WTEXT *ref = wtext_acquire(msgid);
+    wtext_release(textRef);
+    textRef = ref;
+    text = wtext_string(textRef);
 
     for (int i = 0; i < textDynNum; i++) {
         if (textDyn[i]) {
@@ -36,30 +36,92 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <stdlib.h>
+#include <string.h>
 #include <vector>
 
-kaitai::kstream::kstream(std::istream *io) {
-    m_io = io;
+kaitai::kstream::kstream(std::istream *io)
+    : m_io(io), m_buf(NULL), m_size(0), m_pos(0) {
+    init();
+}
+
+kaitai::kstream::kstream(std::string &data)
+    : m_io(NULL), m_buf(reinterpret_cast<const uint8_t *>(data.data())),
+      m_size(data.length()), m_pos(0) {
     init();
 }
 
-kaitai::kstream::kstream(std::string &data) : m_io_str(data) {
-    m_io = &m_io_str;
+kaitai::kstream::kstream(const void *data, size_t length)
+    : m_io(NULL), m_buf(static_cast<const uint8_t *>(data)), m_size(length),
+      m_pos(0) {
     init();
 }
 
 void kaitai::kstream::init() {
-    exceptions_enable();
+    if (m_io != NULL) {
+        exceptions_enable();
+    }
     align_to_byte();
 }
 
+#ifdef KS_NO_EXCEPTIONS
+// Without exceptions, failures outside of any stream are fatal, as
+// libstdc++'s own are under -fno-exceptions.
+#define KS_THROW(type, message)                                                \
+    do {                                                                       \
+        std::cerr << (message) << std::endl;                                   \
+        abort();                                                               \
+    } while (0)
+#else
+#define KS_THROW(type, message) throw type(message)
+#endif
+
+void kaitai::kstream::fail(const char *message) {
+#ifdef KS_NO_EXCEPTIONS
+    m_status.fail(message);
+#else
+    throw std::runtime_error(message);
+#endif
+}
+
+void kaitai::kstream::fail_eof() {
+#ifdef KS_NO_EXCEPTIONS
+    m_status.fail("kstream: read past end of stream");
+#else
+    // Mirror the exception an std::istream-backed stream would throw.
+    throw std::ios_base::failure("kstream: read past end of stream");
+#endif
+}
+
+void kaitai::kstream::read_raw(char *dst, size_t n) {
+    if (m_buf != NULL) {
+        if (n > m_size - m_pos) {
+            fail_eof();
+            memset(dst, 0, n);
+            return;
+        }
+        memcpy(dst, m_buf + m_pos, n);
+        m_pos += n;
+    } else {
+        m_io->read(dst, n);
+#ifdef KS_NO_EXCEPTIONS
+        if (m_io->fail()) {
+            fail_eof();
+            memset(dst, 0, n);
+        }
+#endif
+    }
+}
+
 void kaitai::kstream::close() {
     //  m_io->close();
 }
 
 void kaitai::kstream::exceptions_enable() const {
+#ifndef KS_NO_EXCEPTIONS
     m_io->exceptions(std::istream::eofbit | std::istream::failbit |
                      std::istream::badbit);
+#endif
 }
 
 // ========================================================================
@@ -70,8 +132,13 @@ bool kaitai::kstream::is_eof() const {
     if (m_bits_left > 0) {
         return false;
     }
+    if (m_buf != NULL) {
+        return m_pos >= m_size;
+    }
     char t;
+#ifndef KS_NO_EXCEPTIONS
     m_io->exceptions(std::istream::badbit);
+#endif
     m_io->get(t);
     if (m_io->eof()) {
         m_io->clear();
@@ -84,11 +151,26 @@ bool kaitai::kstream::is_eof() const {
     }
 }
 
-void kaitai::kstream::seek(uint64_t pos) { m_io->seekg(pos); }
+void kaitai::kstream::seek(uint64_t pos) {
+    if (m_buf != NULL) {
+        if (pos > m_size) {
+            fail_eof();
+            return;
+        }
+        m_pos = pos;
+        return;
+    }
+    m_io->seekg(pos);
+#ifdef KS_NO_EXCEPTIONS
+    if (m_io->fail()) {
+        fail_eof();
+    }
+#endif
+}
 
-uint64_t kaitai::kstream::pos() { return m_io->tellg(); }
+uint64_t kaitai::kstream::pos_io() { return m_io->tellg(); }
 
-uint64_t kaitai::kstream::size() {
+uint64_t kaitai::kstream::size_io() {
     std::iostream::pos_type cur_pos = m_io->tellg();
     m_io->seekg(0, std::ios::end);
     std::iostream::pos_type len = m_io->tellg();
@@ -100,149 +182,7 @@ uint64_t kaitai::kstream::size() {
 // Integer numbers
 // ========================================================================
 
-// ------------------------------------------------------------------------
-// Signed
-// ------------------------------------------------------------------------
-
-int8_t kaitai::kstream::read_s1() {
-    char t;
-    m_io->get(t);
-    return t;
-}
-
-// ........................................................................
-// Big-endian
-// ........................................................................
-
-int16_t kaitai::kstream::read_s2be() {
-    int16_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 2);
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-    t = bswap_16(t);
-#endif
-    return t;
-}
-
-int32_t kaitai::kstream::read_s4be() {
-    int32_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 4);
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-    t = bswap_32(t);
-#endif
-    return t;
-}
-
-int64_t kaitai::kstream::read_s8be() {
-    int64_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 8);
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-    t = bswap_64(t);
-#endif
-    return t;
-}
-
-// ........................................................................
-// Little-endian
-// ........................................................................
-
-int16_t kaitai::kstream::read_s2le() {
-    int16_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 2);
-#if __BYTE_ORDER == __BIG_ENDIAN
-    t = bswap_16(t);
-#endif
-    return t;
-}
-
-int32_t kaitai::kstream::read_s4le() {
-    int32_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 4);
-#if __BYTE_ORDER == __BIG_ENDIAN
-    t = bswap_32(t);
-#endif
-    return t;
-}
-
-int64_t kaitai::kstream::read_s8le() {
-    int64_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 8);
-#if __BYTE_ORDER == __BIG_ENDIAN
-    t = bswap_64(t);
-#endif
-    return t;
-}
-
-// ------------------------------------------------------------------------
-// Unsigned
-// ------------------------------------------------------------------------
-
-uint8_t kaitai::kstream::read_u1() {
-    char t;
-    m_io->get(t);
-    return t;
-}
-
-// ........................................................................
-// Big-endian
-// ........................................................................
-
-uint16_t kaitai::kstream::read_u2be() {
-    uint16_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 2);
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-    t = bswap_16(t);
-#endif
-    return t;
-}
-
-uint32_t kaitai::kstream::read_u4be() {
-    uint32_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 4);
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-    t = bswap_32(t);
-#endif
-    return t;
-}
-
-uint64_t kaitai::kstream::read_u8be() {
-    uint64_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 8);
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-    t = bswap_64(t);
-#endif
-    return t;
-}
-
-// ........................................................................
-// Little-endian
-// ........................................................................
-
-uint16_t kaitai::kstream::read_u2le() {
-    uint16_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 2);
-#if __BYTE_ORDER == __BIG_ENDIAN
-    t = bswap_16(t);
-#endif
-    return t;
-}
-
-uint32_t kaitai::kstream::read_u4le() {
-    uint32_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 4);
-#if __BYTE_ORDER == __BIG_ENDIAN
-    t = bswap_32(t);
-#endif
-    return t;
-}
-
-uint64_t kaitai::kstream::read_u8le() {
-    uint64_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 8);
-#if __BYTE_ORDER == __BIG_ENDIAN
-    t = bswap_64(t);
-#endif
-    return t;
-}
+// Integer reads are defined inline within kaitaistream.h.
 
 // ========================================================================
 // Floating point numbers
@@ -254,7 +194,7 @@ uint64_t kaitai::kstream::read_u8le() {
 
 float kaitai::kstream::read_f4be() {
     uint32_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 4);
+    read_raw(reinterpret_cast<char *>(&t), 4);
 #if __BYTE_ORDER == __LITTLE_ENDIAN
     t = bswap_32(t);
 #endif
@@ -263,7 +203,7 @@ float kaitai::kstream::read_f4be() {
 
 double kaitai::kstream::read_f8be() {
     uint64_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 8);
+    read_raw(reinterpret_cast<char *>(&t), 8);
 #if __BYTE_ORDER == __LITTLE_ENDIAN
     t = bswap_64(t);
 #endif
@@ -276,7 +216,7 @@ double kaitai::kstream::read_f8be() {
 
 float kaitai::kstream::read_f4le() {
     uint32_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 4);
+    read_raw(reinterpret_cast<char *>(&t), 4);
 #if __BYTE_ORDER == __BIG_ENDIAN
     t = bswap_32(t);
 #endif
@@ -285,7 +225,7 @@ float kaitai::kstream::read_f4le() {
 
 double kaitai::kstream::read_f8le() {
     uint64_t t;
-    m_io->read(reinterpret_cast<char *>(&t), 8);
+    read_raw(reinterpret_cast<char *>(&t), 8);
 #if __BYTE_ORDER == __BIG_ENDIAN
     t = bswap_64(t);
 #endif
@@ -308,11 +248,12 @@ uint64_t kaitai::kstream::read_bits_int_be(int n) {
         // 8 bits => 1 byte
         // 9 bits => 2 bytes
         int bytes_needed = ((bits_needed - 1) / 8) + 1;
-        if (bytes_needed > 8)
-            throw std::runtime_error(
-                "read_bits_int: more than 8 bytes requested");
+        if (bytes_needed > 8) {
+            fail("read_bits_int: more than 8 bytes requested");
+            return 0;
+        }
         char buf[8];
-        m_io->read(buf, bytes_needed);
+        read_raw(buf, bytes_needed);
         for (int i = 0; i < bytes_needed; i++) {
             uint8_t b = buf[i];
             m_bits <<= 8;
@@ -346,11 +287,12 @@ uint64_t kaitai::kstream::read_bits_int_le(int n) {
         // 8 bits => 1 byte
         // 9 bits => 2 bytes
         int bytes_needed = ((bits_needed - 1) / 8) + 1;
-        if (bytes_needed > 8)
-            throw std::runtime_error(
-                "read_bits_int_le: more than 8 bytes requested");
+        if (bytes_needed > 8) {
+            fail("read_bits_int_le: more than 8 bytes requested");
+            return 0;
+        }
         char buf[8];
-        m_io->read(buf, bytes_needed);
+        read_raw(buf, bytes_needed);
         for (int i = 0; i < bytes_needed; i++) {
             uint8_t b = buf[i];
             m_bits |= (static_cast<uint64_t>(b) << m_bits_left);
@@ -382,22 +324,57 @@ uint64_t kaitai::kstream::get_mask_ones(int n) {
 // ========================================================================
 
 std::string kaitai::kstream::read_bytes(std::streamsize len) {
-    std::vector<char> result(len);
-
     // NOTE: streamsize type is signed, negative values are only *supposed* to
     // not be used. http://en.cppreference.com/w/cpp/io/streamsize
     if (len < 0) {
-        throw std::runtime_error("read_bytes: requested a negative amount");
+        fail("read_bytes: requested a negative amount");
+        return std::string();
+    }
+
+    if (m_buf != NULL) {
+        if ((uint64_t)len > m_size - m_pos) {
+            fail_eof();
+            return std::string();
+        }
+        const char *start = reinterpret_cast<const char *>(m_buf + m_pos);
+        m_pos += len;
+        return std::string(start, len);
     }
 
+    std::vector<char> result(len);
     if (len > 0) {
-        m_io->read(&result[0], len);
+        read_raw(&result[0], len);
     }
 
     return std::string(result.begin(), result.end());
 }
 
+kaitai::bytes_span kaitai::kstream::read_bytes_span(size_t len) {
+    if (m_buf != NULL) {
+        const char *start = reinterpret_cast<const char *>(m_buf + m_pos);
+        if (len > m_size - m_pos) {
+            fail_eof();
+            // Keep the view non-NULL, so that a substream over it remains
+            // memory-backed.
+            return bytes_span(start, 0);
+        }
+        m_pos += len;
+        return bytes_span(start, len);
+    }
+
+    m_span_storage.push_back(read_bytes(len));
+    const std::string &stored = m_span_storage.back();
+    return bytes_span(stored.data(), stored.size());
+}
+
 std::string kaitai::kstream::read_bytes_full() {
+    if (m_buf != NULL) {
+        const char *start = reinterpret_cast<const char *>(m_buf + m_pos);
+        size_t len = m_size - m_pos;
+        m_pos = m_size;
+        return std::string(start, len);
+    }
+
     std::iostream::pos_type p1 = m_io->tellg();
     m_io->seekg(0, std::ios::end);
     std::iostream::pos_type p2 = m_io->tellg();
@@ -416,12 +393,34 @@ std::string kaitai::kstream::read_bytes_full() {
 
 std::string kaitai::kstream::read_bytes_term(char term, bool include,
                                              bool consume, bool eos_error) {
+    if (m_buf != NULL) {
+        const char *start = reinterpret_cast<const char *>(m_buf + m_pos);
+        size_t left = m_size - m_pos;
+        const char *found =
+            static_cast<const char *>(memchr(start, term, left));
+
+        if (found == NULL) {
+            // encountered EOF
+            if (eos_error) {
+                fail("read_bytes_term: encountered EOF");
+                return std::string();
+            }
+            m_pos = m_size;
+            return std::string(start, left);
+        }
+
+        // encountered terminator
+        size_t len = found - start;
+        m_pos += len + (consume ? 1 : 0);
+        return std::string(start, len + (include ? 1 : 0));
+    }
+
     std::string result;
     std::getline(*m_io, result, term);
     if (m_io->eof()) {
         // encountered EOF
         if (eos_error) {
-            throw std::runtime_error("read_bytes_term: encountered EOF");
+            fail("read_bytes_term: encountered EOF");
         }
     } else {
         // encountered terminator
@@ -440,8 +439,7 @@ std::string kaitai::kstream::ensure_fixed_contents(std::string expected) {
         // NOTE: I think printing it outright is not best idea, it could contain
         // non-ascii charactes like backspace and beeps and whatnot. It would be
         // better to print hexlified version, and also to redirect it to stderr.
-        throw std::runtime_error(
-            "ensure_fixed_contents: actual data does not match expected data");
+        fail("ensure_fixed_contents: actual data does not match expected data");
     }
 
     return actual;
@@ -529,7 +527,7 @@ std::string kaitai::kstream::process_zlib(std::string data) {
 
     ret = inflateInit(&strm);
     if (ret != Z_OK)
-        throw std::runtime_error("process_zlib: inflateInit error");
+        KS_THROW(std::runtime_error, "process_zlib: inflateInit error");
 
     strm.next_in = src_ptr;
     strm.avail_in = data.length();
@@ -552,11 +550,11 @@ std::string kaitai::kstream::process_zlib(std::string data) {
     if (ret != Z_STREAM_END) { // an error occurred that was not EOF
         std::ostringstream exc_msg;
         exc_msg << "process_zlib: error #" << ret << "): " << strm.msg;
-        throw std::runtime_error(exc_msg.str());
+        KS_THROW(std::runtime_error, exc_msg.str());
     }
 
     if (inflateEnd(&strm) != Z_OK)
-        throw std::runtime_error("process_zlib: inflateEnd error");
+        KS_THROW(std::runtime_error, "process_zlib: inflateEnd error");
 
     return outstring;
 }
@@ -568,7 +566,7 @@ std::string kaitai::kstream::process_zlib(std::string data) {
 
 int kaitai::kstream::mod(int a, int b) {
     if (b <= 0)
-        throw std::invalid_argument("mod: divisor b <= 0");
+        KS_THROW(std::invalid_argument, "mod: divisor b <= 0");
     int r = a % b;
     if (r < 0)
         r += b;
@@ -586,8 +584,8 @@ std::string kaitai::kstream::to_string(int val) {
 
     // should never happen, but check nonetheless
     if (got_len > (int)sizeof(buf))
-        throw std::invalid_argument(
-            "to_string: integer is longer than string buffer");
+        KS_THROW(std::invalid_argument,
+                 "to_string: integer is longer than string buffer");
 
     return std::string(buf);
 }
@@ -633,24 +631,164 @@ uint8_t kaitai::kstream::byte_array_max(const std::string val) {
 
 #ifdef KS_STR_ENCODING_ICONV
 
+#include <atomic>
 #include <cerrno>
 #include <iconv.h>
 #include <stdexcept>
 
-// As defined within our custom musl iconv.
-// Again, the author apologizes, but we lack errno.
-extern int iconv_error;
+// As defined within our custom musl iconv. These report errors through
+// the given pointer, as we lack errno, and may be called concurrently.
+extern "C" iconv_t iconv_open_r(const char *to, const char *from, int *error);
+extern "C" size_t iconv_r(iconv_t cd, char **in, size_t *inb, char **out,
+                          size_t *outb, int *error);
 
 std::string kaitai::kstream::bytes_to_str(std::string src,
                                           std::string src_enc) {
-    iconv_t cd = iconv_open(KS_STR_DEFAULT_ENCODING, src_enc.c_str());
+    return bytes_to_str(bytes_span(src.data(), src.size()), src_enc.c_str());
+}
+
+// iconv_open searches every charmap for both encodings. As we only ever
+// convert into KS_STR_DEFAULT_ENCODING, descriptors are cached by source
+// encoding and reused. Stateful descriptors are never cached, as musl's
+// iconv offers no way to reset them, nor are they safe to share.
+//
+// Threads reserve a slot, fill it, then mark it ready, so that lookups
+// never observe a partially written entry. Should two threads race to
+// cache the same encoding, both entries are equally valid.
+#define KS_ICONV_CACHE_SIZE 4
+#define KS_ICONV_NAME_LENGTH 32
+
+struct iconv_cache_entry {
+    char from[KS_ICONV_NAME_LENGTH];
+    iconv_t cd;
+    std::atomic<bool> ready;
+};
+
+static iconv_cache_entry iconv_cache[KS_ICONV_CACHE_SIZE];
+static std::atomic<size_t> iconv_cache_reserved(0);
+
+static iconv_t iconv_open_cached(const char *from, bool *cached, int *error) {
+    size_t count = iconv_cache_reserved.load(std::memory_order_acquire);
+    if (count > KS_ICONV_CACHE_SIZE) {
+        count = KS_ICONV_CACHE_SIZE;
+    }
+    for (size_t i = 0; i < count; i++) {
+        iconv_cache_entry &entry = iconv_cache[i];
+        if (entry.ready.load(std::memory_order_acquire) &&
+            strcmp(entry.from, from) == 0) {
+            *cached = true;
+            return entry.cd;
+        }
+    }
 
+    iconv_t cd = iconv_open_r(KS_STR_DEFAULT_ENCODING, from, error);
+    *cached = false;
     if (cd == (iconv_t)-1) {
-        if (iconv_error == EINVAL) {
-            throw std::runtime_error(
-                "bytes_to_str: invalid encoding pair conversion requested");
+        return cd;
+    }
+
+    bool stateful = !((size_t)cd & 1);
+    if (stateful || strlen(from) >= KS_ICONV_NAME_LENGTH ||
+        iconv_cache_reserved.load(std::memory_order_relaxed) >=
+            KS_ICONV_CACHE_SIZE) {
+        return cd;
+    }
+
+    size_t slot = iconv_cache_reserved.fetch_add(1, std::memory_order_acq_rel);
+    if (slot < KS_ICONV_CACHE_SIZE) {
+        iconv_cache_entry &entry = iconv_cache[slot];
+        strcpy(entry.from, from);
+        entry.cd = cd;
+        entry.ready.store(true, std::memory_order_release);
+        *cached = true;
+    }
+
+    return cd;
+}
+
+// Converts UTF-16BE to UTF-8 without iconv's general state machine,
+// rejecting what our musl iconv would. A first pass sizes the result
+// exactly, allowing a single allocation. Returns an error message on
+// failure, or NULL.
+static const char *utf16be_to_utf8(const kaitai::bytes_span &src,
+                                   std::string &dst) {
+    const uint8_t *in = reinterpret_cast<const uint8_t *>(src.data());
+    size_t units = src.size() / 2;
+
+    // An odd trailing byte, or an unpaired surrogate, is an error.
+    if (src.size() % 2 != 0) {
+        return "bytes_to_str: iconv error";
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < units; i++) {
+        unsigned c = (in[i * 2] << 8) | in[i * 2 + 1];
+        if (c < 0x80) {
+            length += 1;
+        } else if (c < 0x800) {
+            length += 2;
+        } else if (c - 0xd800 < 0x400) {
+            unsigned d = i + 1 < units ? (in[i * 2 + 2] << 8) | in[i * 2 + 3]
+                                       : 0;
+            if (d - 0xdc00 >= 0x400) {
+                return "bytes_to_str: iconv error";
+            }
+            length += 4;
+            i++;
+        } else if (c - 0xdc00 < 0x400) {
+            return "bytes_to_str: iconv error";
         } else {
-            throw std::runtime_error("bytes_to_str: error opening iconv");
+            length += 3;
+        }
+    }
+
+    dst.assign(length, '\0');
+    char *out = &dst[0];
+    for (size_t i = 0; i < units; i++) {
+        unsigned c = (in[i * 2] << 8) | in[i * 2 + 1];
+        if (c - 0xd800 < 0x400) {
+            unsigned d = (in[i * 2 + 2] << 8) | in[i * 2 + 3];
+            c = ((c - 0xd7c0) << 10) + (d - 0xdc00);
+            i++;
+        }
+
+        if (c < 0x80) {
+            *out++ = c;
+        } else if (c < 0x800) {
+            *out++ = 0xc0 | (c >> 6);
+            *out++ = 0x80 | (c & 0x3f);
+        } else if (c < 0x10000) {
+            *out++ = 0xe0 | (c >> 12);
+            *out++ = 0x80 | ((c >> 6) & 0x3f);
+            *out++ = 0x80 | (c & 0x3f);
+        } else {
+            *out++ = 0xf0 | (c >> 18);
+            *out++ = 0x80 | ((c >> 12) & 0x3f);
+            *out++ = 0x80 | ((c >> 6) & 0x3f);
+            *out++ = 0x80 | (c & 0x3f);
+        }
+    }
+
+    return NULL;
+}
+
+// Converts src into dst. Returns an error message on failure, or NULL.
+static const char *convert_str(kaitai::bytes_span src, const char *src_enc,
+                               std::string &dst) {
+    if (strcmp(src_enc, "UTF-16BE") == 0 &&
+        strcmp(KS_STR_DEFAULT_ENCODING, "UTF-8") == 0) {
+        return utf16be_to_utf8(src, dst);
+    }
+
+    bool cached;
+    int error = 0;
+    iconv_t cd = iconv_open_cached(src_enc, &cached, &error);
+
+    if (cd == (iconv_t)-1) {
+        if (error == EINVAL) {
+            return "bytes_to_str: invalid encoding pair conversion requested";
+        } else {
+            return "bytes_to_str: error opening iconv";
         }
     }
 
@@ -659,17 +797,19 @@ std::string kaitai::kstream::bytes_to_str(std::string src,
 
     // Start with a buffer length of double the source length.
     size_t dst_len = src_len * 2;
-    std::string dst(dst_len, ' ');
+    dst.assign(dst_len, ' ');
     size_t dst_left = dst_len;
 
-    char *src_ptr = &src[0];
+    // iconv does not modify its input, despite its signature.
+    char *src_ptr = const_cast<char *>(src.data());
     char *dst_ptr = &dst[0];
 
     while (true) {
-        size_t res = iconv(cd, &src_ptr, &src_left, &dst_ptr, &dst_left);
+        size_t res =
+            iconv_r(cd, &src_ptr, &src_left, &dst_ptr, &dst_left, &error);
 
         if (res == (size_t)-1) {
-            if (iconv_error == E2BIG) {
+            if (error == E2BIG) {
                 // dst buffer is not enough to accomodate whole string
                 // enlarge the buffer and try again
                 size_t dst_used = dst_len - dst_left;
@@ -682,8 +822,11 @@ std::string kaitai::kstream::bytes_to_str(std::string src,
                 // invalid; re-point it using "dst_used".
                 dst_ptr = &dst[dst_used];
             } else {
-                std::cout << iconv_error << std::endl;
-                throw std::runtime_error("bytes_to_str: iconv error");
+                std::cout << error << std::endl;
+                if (!cached) {
+                    iconv_close(cd);
+                }
+                return "bytes_to_str: iconv error";
             }
         } else {
             // conversion successful
@@ -692,10 +835,36 @@ std::string kaitai::kstream::bytes_to_str(std::string src,
         }
     }
 
-    if (iconv_close(cd) != 0) {
-        throw std::runtime_error("bytes_to_str: iconv close error");
+    if (!cached && iconv_close(cd) != 0) {
+        return "bytes_to_str: iconv close error";
+    }
+
+    return NULL;
+}
+
+std::string kaitai::kstream::bytes_to_str(bytes_span src,
+                                          const char *src_enc) {
+    std::string dst;
+    const char *error = convert_str(src, src_enc, dst);
+    if (error != NULL) {
+        KS_THROW(std::runtime_error, error);
     }
+    return dst;
+}
 
+std::string kaitai::kstream::bytes_to_str(bytes_span src, const char *src_enc,
+                                          parse_status *status,
+                                          const char *path) {
+    std::string dst;
+    const char *error = convert_str(src, src_enc, dst);
+    if (error != NULL) {
+#ifdef KS_NO_EXCEPTIONS
+        status->fail(error, path);
+        return std::string();
+#else
+        throw std::runtime_error(error);
+#endif
+    }
     return dst;
 }
 #elif defined(KS_STR_ENCODING_NONE)
@@ -703,6 +872,17 @@ std::string kaitai::kstream::bytes_to_str(std::string src,
                                           std::string src_enc) {
     return src;
 }
+
+std::string kaitai::kstream::bytes_to_str(bytes_span src,
+                                          const char *src_enc) {
+    return src.str();
+}
+
+std::string kaitai::kstream::bytes_to_str(bytes_span src, const char *src_enc,
+                                          parse_status *status,
+                                          const char *path) {
+    return src.str();
+}
 #else
 #error Need to decide how to handle strings: please define one of: KS_STR_ENCODING_ICONV, KS_STR_ENCODING_NONE
 #endif
@@ -4,17 +4,91 @@
 // Kaitai Struct runtime API version: x.y.z = 'xxxyyyzzz' decimal
 #define KAITAI_STRUCT_VERSION 9000L
 
+#include <ios>
 #include <istream>
 #include <sstream>
+#include <stddef.h>
 #include <stdint.h>
+#include <deque>
+#include <string.h>
 #include <sys/types.h>
 
 namespace kaitai {
 
+/**
+ * Non-owning view of bytes read by kstream::read_bytes_span. It remains
+ * valid for as long as the memory or kstream it was read from.
+ */
+class bytes_span {
+  public:
+    bytes_span() : m_data(NULL), m_size(0) {}
+    bytes_span(const char *data, size_t size) : m_data(data), m_size(size) {}
+
+    const char *data() const { return m_data; }
+    size_t size() const { return m_size; }
+    size_t length() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    char operator[](size_t i) const { return m_data[i]; }
+
+    /** Copies the viewed bytes, should an owning string be necessary. */
+    std::string str() const { return std::string(m_data, m_size); }
+
+    bool operator==(const std::string &other) const {
+        return m_size == other.size() &&
+               memcmp(m_data, other.data(), m_size) == 0;
+    }
+    bool operator!=(const std::string &other) const {
+        return !(*this == other);
+    }
+    bool operator==(const bytes_span &other) const {
+        return m_size == other.m_size &&
+               memcmp(m_data, other.m_data, m_size) == 0;
+    }
+    bool operator!=(const bytes_span &other) const {
+        return !(*this == other);
+    }
+
+  private:
+    const char *m_data;
+    size_t m_size;
+};
+
+/**
+ * The first failure encountered while parsing. When built with
+ * KS_NO_EXCEPTIONS, failures are recorded here rather than thrown, and
+ * parsing carries on with zeroed or empty values.
+ */
+class parse_status {
+  public:
+    parse_status() : m_message(NULL), m_path(NULL) {}
+
+    bool ok() const { return m_message == NULL; }
+    const char *message() const { return m_message; }
+
+    /** KSY path of the element that failed, or NULL if unknown. */
+    const char *path() const { return m_path; }
+
+    /**
+     * Records a failure, unless one was recorded already. Both strings
+     * must be static.
+     */
+    void fail(const char *message, const char *path = NULL) {
+        if (m_message == NULL) {
+            m_message = message;
+            m_path = path;
+        }
+    }
+
+  private:
+    const char *m_message;
+    const char *m_path;
+};
+
 /**
  * Kaitai Stream class (kaitai::kstream) is an implementation of
  * <a href="https://doc.kaitai.io/stream_api.html">Kaitai Struct stream API</a>
- * for C++/STL. It's implemented as a wrapper over generic STL std::istream.
+ * for C++/STL. It's implemented as a wrapper over generic STL std::istream,
+ * or directly over a span of memory.
  *
  * It provides a wide variety of simple methods to read (parse) binary
  * representations of primitive types, such as integer and floating
@@ -38,11 +112,19 @@ class kstream {
 
     /**
      * Constructs new Kaitai Stream object, wrapping a given in-memory data
-     * buffer.
+     * buffer. The buffer is read in place, and must outlive this stream.
      * \param data data buffer to use for this Kaitai Stream
      */
     kstream(std::string &data);
 
+    /**
+     * Constructs new Kaitai Stream object, reading directly from memory.
+     * The memory is not copied, and must outlive this stream.
+     * \param data start of the memory to read
+     * \param length length of the memory in bytes
+     */
+    kstream(const void *data, size_t length);
+
     void close();
 
     /** @name Stream positioning */
@@ -69,15 +151,21 @@ class kstream {
      * \return pointer position, number of bytes from the beginning of the
      * stream
      */
-    uint64_t pos();
+    uint64_t pos() { return m_buf != NULL ? m_pos : pos_io(); }
 
     /**
      * Get total size of the stream in bytes.
      * \return size of the stream in bytes
      */
-    uint64_t size();
+    uint64_t size() { return m_buf != NULL ? m_size : size_io(); }
     //@}
 
+    /**
+     * Get the first failure of this stream. It is always successful unless
+     * built with KS_NO_EXCEPTIONS, as failures are thrown otherwise.
+     */
+    const parse_status &status() const { return m_status; }
+
     /** @name Integer numbers */
     //@{
 
@@ -85,45 +173,84 @@ class kstream {
     // Signed
     // ------------------------------------------------------------------------
 
-    int8_t read_s1();
+    int8_t read_s1() { return read_u1(); }
 
     // ........................................................................
     // Big-endian
     // ........................................................................
 
-    int16_t read_s2be();
-    int32_t read_s4be();
-    int64_t read_s8be();
+    int16_t read_s2be() { return read_u2be(); }
+    int32_t read_s4be() { return read_u4be(); }
+    int64_t read_s8be() { return read_u8be(); }
 
     // ........................................................................
     // Little-endian
     // ........................................................................
 
-    int16_t read_s2le();
-    int32_t read_s4le();
-    int64_t read_s8le();
+    int16_t read_s2le() { return read_u2le(); }
+    int32_t read_s4le() { return read_u4le(); }
+    int64_t read_s8le() { return read_u8le(); }
 
     // ------------------------------------------------------------------------
     // Unsigned
     // ------------------------------------------------------------------------
 
-    uint8_t read_u1();
+    uint8_t read_u1() {
+        uint8_t scratch[1];
+        return take(1, scratch)[0];
+    }
 
     // ........................................................................
     // Big-endian
     // ........................................................................
 
-    uint16_t read_u2be();
-    uint32_t read_u4be();
-    uint64_t read_u8be();
+    uint16_t read_u2be() {
+        uint8_t scratch[2];
+        const uint8_t *p = take(2, scratch);
+        return (uint16_t)((p[0] << 8) | p[1]);
+    }
+
+    uint32_t read_u4be() {
+        uint8_t scratch[4];
+        const uint8_t *p = take(4, scratch);
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+               ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+    }
+
+    uint64_t read_u8be() {
+        uint8_t scratch[8];
+        const uint8_t *p = take(8, scratch);
+        return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) |
+               ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+               ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) |
+               ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+    }
 
     // ........................................................................
     // Little-endian
     // ........................................................................
 
-    uint16_t read_u2le();
-    uint32_t read_u4le();
-    uint64_t read_u8le();
+    uint16_t read_u2le() {
+        uint8_t scratch[2];
+        const uint8_t *p = take(2, scratch);
+        return (uint16_t)((p[1] << 8) | p[0]);
+    }
+
+    uint32_t read_u4le() {
+        uint8_t scratch[4];
+        const uint8_t *p = take(4, scratch);
+        return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) |
+               ((uint32_t)p[1] << 8) | (uint32_t)p[0];
+    }
+
+    uint64_t read_u8le() {
+        uint8_t scratch[8];
+        const uint8_t *p = take(8, scratch);
+        return ((uint64_t)p[7] << 56) | ((uint64_t)p[6] << 48) |
+               ((uint64_t)p[5] << 40) | ((uint64_t)p[4] << 32) |
+               ((uint64_t)p[3] << 24) | ((uint64_t)p[2] << 16) |
+               ((uint64_t)p[1] << 8) | (uint64_t)p[0];
+    }
 
     //@}
 
@@ -160,6 +287,13 @@ class kstream {
     //@{
 
     std::string read_bytes(std::streamsize len);
+
+    /**
+     * Reads len bytes without copying them from a memory-backed stream.
+     * std::istream-backed streams retain a copy for the view to refer to
+     * until the stream is destroyed.
+     */
+    bytes_span read_bytes_span(size_t len);
     std::string read_bytes_full();
     std::string read_bytes_term(char term, bool include, bool consume,
                                 bool eos_error);
@@ -169,6 +303,14 @@ class kstream {
     static std::string bytes_terminate(std::string src, char term,
                                        bool include);
     static std::string bytes_to_str(std::string src, std::string src_enc);
+    static std::string bytes_to_str(bytes_span src, const char *src_enc);
+
+    /**
+     * As above, but failures are recorded to status against path when built
+     * with KS_NO_EXCEPTIONS, returning an empty string.
+     */
+    static std::string bytes_to_str(bytes_span src, const char *src_enc,
+                                    parse_status *status, const char *path);
 
     //@}
 
@@ -255,14 +397,55 @@ class kstream {
     static uint8_t byte_array_max(const std::string val);
 
   private:
+    // Exactly one of m_io or m_buf is in use.
     std::istream *m_io;
-    std::istringstream m_io_str;
+    const uint8_t *m_buf;
+    uint64_t m_size;
+    uint64_t m_pos;
     int m_bits_left;
     uint64_t m_bits;
+    parse_status m_status;
+
+    // Bytes read by read_bytes_span from an std::istream, kept alive
+    // for their views. A deque never relocates existing elements.
+    std::deque<std::string> m_span_storage;
 
     void init();
     void exceptions_enable() const;
 
+    uint64_t pos_io();
+    uint64_t size_io();
+
+    /**
+     * Consumes n bytes. Memory-backed streams return a pointer to them in
+     * place, whereas std::istream-backed streams read them into scratch.
+     */
+    const uint8_t *take(size_t n, uint8_t *scratch) {
+        if (m_buf != NULL) {
+            if (n > m_size - m_pos) {
+                fail_eof();
+                memset(scratch, 0, n);
+                return scratch;
+            }
+            const uint8_t *p = m_buf + m_pos;
+            m_pos += n;
+            return p;
+        }
+
+        read_raw(reinterpret_cast<char *>(scratch), n);
+        return scratch;
+    }
+
+    /** Reads n bytes into dst, for either kind of stream. */
+    void read_raw(char *dst, size_t n);
+
+    /**
+     * Throws, or records to m_status when built with KS_NO_EXCEPTIONS.
+     * message must be static.
+     */
+    void fail(const char *message);
+    void fail_eof();
+
     static uint64_t get_mask_ones(int n);
 
     static const int ZLIB_BUF_SIZE = 128 * 1024;
@@ -21,6 +21,9 @@
 #define UCS2 0314
 #define SHIFT_JIS 0321
 
+/* Set by iconv_open and iconv, as we lack a usable errno. It is shared by
+ * every thread: use iconv_open_r and iconv_r to have errors reported per
+ * call instead. */
 int iconv_error = 0;
 
 /* Definitions of charmaps. Each charmap consists of:
@@ -36,37 +39,48 @@ int iconv_error = 0;
  * are elided since those characters are obviously all included. */
 #include "locale/jis0208.h"
 #include "locale/legacychars.h"
-#include "locale/revjis.h"
-
-static int fuzzycmp(const unsigned char *a, const unsigned char *b) {
-    for (; *a && *b; a++, b++) {
-        while (*a && (*a | 32U) - 'a' > 26 && *a - '0' > 10U)
-            a++;
-        if ((*a | 32U) != *b)
-            return 1;
+#include "locale/revsjis.h"
+
+/* Aliases are looked up through a perfect hash of their normalized form,
+ * which follows musl's fuzzy matching: letters are compared without case,
+ * and any other characters are ignored, except after the last letter or
+ * digit. */
+#include "locale/codepages_hash.h"
+
+static uint32_t charmap_hash(const unsigned char *s, size_t n, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < n; i++) {
+        h ^= s[i];
+        h *= 16777619u;
     }
-    return *a != *b;
+    return h;
 }
 
 static size_t find_charmap(const void *name) {
-    const unsigned char *s;
-    if (!*(char *)name)
-        name = charmaps; /* "utf8" */
-    for (s = charmaps; *s;) {
-        if (!fuzzycmp(name, s)) {
-            for (; *s; s += strlen((void *)s) + 1)
-                ;
-            return s + 1 - charmaps;
-        }
-        s += strlen((void *)s) + 1;
-        if (!*s) {
-            if (s[1] > 0200)
-                s += 2;
-            else
-                s += 2 + (64U - s[1]) * 5;
-        }
+    const unsigned char *s = name;
+    unsigned char key[CHARMAP_NAME_MAX];
+    size_t n = 0;
+    if (!*s)
+        s = charmaps; /* "utf8" */
+    for (; *s; s++) {
+        if ((*s | 32U) - 'a' > 26 && *s - '0' > 10U)
+            continue;
+        if (n == CHARMAP_NAME_MAX)
+            return -1;
+        key[n++] = *s | 32U;
     }
-    return -1;
+    if (!n || ((s[-1] | 32U) - 'a' > 26 && s[-1] - '0' > 10U))
+        return -1;
+
+    uint32_t seed =
+        charmap_hash_seeds[charmap_hash(key, n, 0) % CHARMAP_HASH_BUCKETS];
+    size_t slot = charmap_hash(key, n, seed) % CHARMAP_HASH_SLOTS;
+    if (charmap_hash_slots[slot].name == CHARMAP_HASH_EMPTY)
+        return -1;
+    const unsigned char *alias = charmaps + charmap_hash_slots[slot].name;
+    if (strncmp((const void *)alias, (const void *)key, n) || alias[n])
+        return -1;
+    return charmap_hash_slots[slot].charmap;
 }
 
 struct stateful_cd {
@@ -82,13 +96,14 @@ static size_t extract_from(iconv_t cd) { return (size_t)cd >> 16; }
 
 static size_t extract_to(iconv_t cd) { return (size_t)cd >> 1 & 0x7fff; }
 
-iconv_t iconv_open(const char *to, const char *from) {
+iconv_t iconv_open_r(const char *to, const char *from, int *error) {
     size_t f, t;
     struct stateful_cd *scd;
 
     if ((t = find_charmap(to)) == -1 || (f = find_charmap(from)) == -1 ||
         (charmaps[t] >= 0330)) {
-        iconv_error = EINVAL;
+        if (error)
+            *error = EINVAL;
         return (iconv_t)-1;
     }
     iconv_t cd = combine_to_from(t, f);
@@ -98,8 +113,11 @@ iconv_t iconv_open(const char *to, const char *from) {
     case UTF_32:
     case UCS2:
         scd = malloc(sizeof *scd);
-        if (!scd)
+        if (!scd) {
+            if (error)
+                *error = ENOMEM;
             return (iconv_t)-1;
+        }
         scd->base_cd = cd;
         scd->state = 0;
         cd = (iconv_t)scd;
@@ -108,6 +126,10 @@ iconv_t iconv_open(const char *to, const char *from) {
     return cd;
 }
 
+iconv_t iconv_open(const char *to, const char *from) {
+    return iconv_open_r(to, from, &iconv_error);
+}
+
 static unsigned get_16(const unsigned char *s, int e) {
     e &= 1;
     return s[e] << 8 | s[1 - e];
@@ -132,9 +154,71 @@ static void put_32(unsigned char *s, unsigned c, int e) {
     s[e ^ 3] = c;
 }
 
-/* Adapt as needed */
-#define mbrtowc_utf8 mbrtowc
-#define wctomb_utf8 wctomb
+/* musl relies on its own UTF-8 locale here. newlib's mbrtowc and wctomb
+ * instead follow the current locale and keep hidden state, so UTF-8 is
+ * handled locally, keeping iconv_r reentrant. */
+static size_t mbrtowc_utf8(wchar_t *wc, const char *src, size_t n) {
+    const unsigned char *s = (const void *)src;
+    unsigned c = *s, length, min = 0x80, max = 0xbf;
+
+    if (c - 0xc2 > 0xf4 - 0xc2)
+        return -1;
+    if (c < 0xe0) {
+        length = 2;
+        c &= 0x1f;
+    } else if (c < 0xf0) {
+        length = 3;
+        c &= 0x0f;
+    } else {
+        length = 4;
+        c &= 0x07;
+    }
+
+    /* Reject overlong forms, surrogates and anything past U+10FFFF
+     * as soon as the second byte allows. */
+    if (*s == 0xe0)
+        min = 0xa0;
+    else if (*s == 0xed)
+        max = 0x9f;
+    else if (*s == 0xf0)
+        min = 0x90;
+    else if (*s == 0xf4)
+        max = 0x8f;
+
+    for (unsigned i = 1; i < length; i++) {
+        if (i >= n)
+            return -2;
+        if (s[i] < min || s[i] > max)
+            return -1;
+        c = c << 6 | (s[i] & 0x3f);
+        min = 0x80;
+        max = 0xbf;
+    }
+
+    *wc = c;
+    return length;
+}
+
+static size_t wctomb_utf8(char *s, unsigned c) {
+    if (c < 0x80) {
+        *s = c;
+        return 1;
+    } else if (c < 0x800) {
+        *s++ = 0xc0 | c >> 6;
+        *s = 0x80 | (c & 0x3f);
+        return 2;
+    } else if (c < 0x10000) {
+        *s++ = 0xe0 | c >> 12;
+        *s++ = 0x80 | (c >> 6 & 0x3f);
+        *s = 0x80 | (c & 0x3f);
+        return 3;
+    }
+    *s++ = 0xf0 | c >> 18;
+    *s++ = 0x80 | (c >> 12 & 0x3f);
+    *s++ = 0x80 | (c >> 6 & 0x3f);
+    *s = 0x80 | (c & 0x3f);
+    return 4;
+}
 
 static unsigned legacy_map(const unsigned char *map, unsigned c) {
     if (c < 4 * map[-1])
@@ -145,28 +229,19 @@ static unsigned legacy_map(const unsigned char *map, unsigned c) {
     return x < 256 ? x : legacy_chars[x - 256];
 }
 
-static unsigned uni_to_jis(unsigned c) {
-    unsigned nel = sizeof rev_jis / sizeof *rev_jis;
-    unsigned d, j, i, b = 0;
-    for (;;) {
-        i = nel / 2;
-        j = rev_jis[b + i];
-        d = jis0208[j / 256][j % 256];
-        if (d == c)
-            return j + 0x2121;
-        else if (nel == 1)
-            return 0;
-        else if (c < d)
-            nel /= 2;
-        else {
-            b += i;
-            nel -= nel / 2;
-        }
-    }
+/* Returns both Shift_JIS bytes of a JIS X 0208 character, or 0 if c has
+ * none. */
+static unsigned uni_to_sjis(unsigned c) {
+    if (c > 0xffff)
+        return 0;
+    return rev_sjis[rev_sjis_index[c >> 8]][c & 0xff];
 }
 
-size_t iconv(iconv_t cd, char **restrict in, size_t *restrict inb,
-             char **restrict out, size_t *restrict outb) {
+/* Descriptors for stateless encodings are plain values, and may be shared
+ * between threads. Those opened from UTF-16, UTF-32 or UCS-2 record the byte
+ * order of their input, and must not be. */
+size_t iconv_r(iconv_t cd, char **restrict in, size_t *restrict inb,
+               char **restrict out, size_t *restrict outb, int *error) {
     size_t x = 0;
     struct stateful_cd *scd = 0;
     if (!((size_t)cd & 1)) {
@@ -177,7 +252,6 @@ size_t iconv(iconv_t cd, char **restrict in, size_t *restrict inb,
     unsigned from = extract_from(cd);
     const unsigned char *map = charmaps + from + 1;
     const unsigned char *tomap = charmaps + to + 1;
-    mbstate_t st = {0};
     wchar_t wc;
     unsigned c, d;
     size_t k, l;
@@ -199,7 +273,7 @@ size_t iconv(iconv_t cd, char **restrict in, size_t *restrict inb,
         case UTF_8:
             if (c < 128)
                 break;
-            l = mbrtowc_utf8(&wc, *in, *inb, &st);
+            l = mbrtowc_utf8(&wc, *in, *inb);
             if (l == (size_t)-1)
                 goto ilseq;
             if (l == (size_t)-2)
@@ -302,7 +376,10 @@ size_t iconv(iconv_t cd, char **restrict in, size_t *restrict inb,
             } else if (d - 159 <= 252 - 159) {
                 c++;
                 d -= 159;
-            }
+            } else
+                goto ilseq;
+            if (c >= 84)
+                goto ilseq;
             c = jis0208[c][d];
             if (!c)
                 goto ilseq;
@@ -374,15 +451,13 @@ size_t iconv(iconv_t cd, char **restrict in, size_t *restrict inb,
                 c += 0xa1 - 0xff61;
                 goto revout;
             }
-            c = uni_to_jis(c);
+            c = uni_to_sjis(c);
             if (!c)
                 goto subst;
             if (*outb < 2)
                 goto toobig;
-            d = c % 256;
-            c = c / 256;
-            *(*out)++ = (c + 1) / 2 + (c < 95 ? 112 : 176);
-            *(*out)++ = c % 2 ? d + 31 + d / 96 : d + 126;
+            *(*out)++ = c >> 8;
+            *(*out)++ = c;
             *outb -= 2;
             break;
         case UCS2:
@@ -436,7 +511,13 @@ starved:
     err = EINVAL;
     x = -1;
 end:
-    iconv_error = err;
+    if (error)
+        *error = err;
     ploc = loc;
     return x;
 }
+
+size_t iconv(iconv_t cd, char **restrict in, size_t *restrict inb,
+             char **restrict out, size_t *restrict outb) {
+    return iconv_r(cd, in, inb, out, outb, &iconv_error);
+}
@@ -14,13 +14,19 @@ extern "C" {
 typedef void *iconv_t;
 
 // The author apologizes, but we do not have errno.
-static int iconv_error;
+extern int iconv_error;
 
 iconv_t iconv_open(const char *, const char *);
 size_t iconv(iconv_t, char **__restrict, size_t *__restrict, char **__restrict,
              size_t *__restrict);
 int iconv_close(iconv_t);
 
+// As above, but reporting errors through the given pointer, if not NULL,
+// rather than iconv_error.
+iconv_t iconv_open_r(const char *, const char *, int *);
+size_t iconv_r(iconv_t, char **__restrict, size_t *__restrict,
+               char **__restrict, size_t *__restrict, int *);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,149 @@
+/* This is a generated file! Please edit codepages.h and use codepages_hash.py to rebuild */
+
+#define CHARMAP_HASH_BUCKETS 32
+#define CHARMAP_HASH_SLOTS 128
+#define CHARMAP_HASH_EMPTY 0xFFFF
+#define CHARMAP_NAME_MAX 11
+
+_Static_assert(sizeof charmaps == 4884,
+               "codepages_hash.h is out of date with codepages.h");
+
+static const unsigned char charmap_hash_seeds[CHARMAP_HASH_BUCKETS] = {
+    2, 1, 0, 0, 3, 2, 2, 1, 1, 0, 0, 0,
+    4, 4, 2, 0, 1, 1, 1, 2, 1, 0, 0, 1,
+    1, 1, 0, 0, 2, 9, 3, 19,
+};
+
+/* Offsets of each slot's alias and charmap within charmaps. */
+static const struct {
+    unsigned short name, charmap;
+} charmap_hash_slots[CHARMAP_HASH_SLOTS] = {
+    {CHARMAP_HASH_EMPTY, 0},
+    {2994, 3007}, /* windows1255 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {0, 11}, /* utf8 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {5, 11}, /* char */
+    {39, 48}, /* utf16be */
+    {CHARMAP_HASH_EMPTY, 0},
+    {4559, 4567}, /* cp1047 */
+    {114, 124}, /* iso646us */
+    {CHARMAP_HASH_EMPTY, 0},
+    {3879, 3886}, /* koi8u */
+    {21, 29}, /* ucs2be */
+    {CHARMAP_HASH_EMPTY, 0},
+    {83, 92}, /* utf32le */
+    {CHARMAP_HASH_EMPTY, 0},
+    {3168, 3188}, /* cp1256 */
+    {66, 75}, /* utf32be */
+    {189, 198}, /* gb18030 */
+    {30, 38}, /* ucs2le */
+    {251, 274}, /* ksc5601 */
+    {2806, 2826}, /* cp1254 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {125, 132}, /* utf16 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {3530, 3550}, /* cp1258 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {146, 152}, /* ucs2 */
+    {2082, 2102}, /* cp1250 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {1950, 1961}, /* iso885916 */
+    {284, 292}, /* latin1 */
+    {245, 274}, /* euckr */
+    {2632, 2645}, /* windows1253 */
+    {1423, 1431}, /* tis620 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {12, 20}, /* wchart */
+    {259, 274}, /* ksx1001 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {170, 176}, /* sjis */
+    {686, 696}, /* iso88595 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {2089, 2102}, /* windows1250 */
+    {2451, 2464}, /* windows1252 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {233, 244}, /* big5hkscs */
+    {CHARMAP_HASH_EMPTY, 0},
+    {2263, 2283}, /* cp1251 */
+    {2270, 2283}, /* windows1251 */
+    {199, 204}, /* gbk */
+    {107, 124}, /* iso646 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {219, 244}, /* bigfive */
+    {CHARMAP_HASH_EMPTY, 0},
+    {76, 92}, /* ucs4le */
+    {1826, 1834}, /* latin9 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {227, 244}, /* cp950 */
+    {133, 145}, /* ucs4 */
+    {555, 565}, /* iso88594 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {3349, 3369}, /* cp1257 */
+    {153, 160}, /* eucjp */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {3711, 3718}, /* koi8r */
+    {3175, 3188}, /* windows1256 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {1816, 1834}, /* iso885915 */
+    {161, 176}, /* shiftjis */
+    {2625, 2645}, /* cp1253 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {2987, 3007}, /* cp1255 */
+    {3537, 3550}, /* windows1258 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {424, 434}, /* iso88593 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {93, 124}, /* ascii */
+    {CHARMAP_HASH_EMPTY, 0},
+    {59, 75}, /* ucs4be */
+    {817, 827}, /* iso88596 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {99, 124}, /* usascii */
+    {CHARMAP_HASH_EMPTY, 0},
+    {267, 274}, /* cp949 */
+    {948, 958}, /* iso88597 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {1210, 1220}, /* iso88599 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {138, 145}, /* utf32 */
+    {214, 244}, /* big5 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {4551, 4567}, /* ibm1047 */
+    {3356, 3369}, /* windows1257 */
+    {1552, 1563}, /* iso885913 */
+    {293, 303}, /* iso88592 */
+    {205, 213}, /* gb2312 */
+    {2813, 2826}, /* windows1254 */
+    {1413, 1431}, /* iso885911 */
+    {4215, 4222}, /* cp850 */
+    {177, 188}, /* iso2022jp */
+    {1684, 1695}, /* iso885914 */
+    {4047, 4054}, /* cp437 */
+    {49, 58}, /* utf16le */
+    {1079, 1089}, /* iso88598 */
+    {4383, 4390}, /* cp866 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {CHARMAP_HASH_EMPTY, 0},
+    {275, 292}, /* iso88591 */
+    {2444, 2464}, /* cp1252 */
+    {CHARMAP_HASH_EMPTY, 0},
+    {1281, 1292}, /* iso885910 */
+    {CHARMAP_HASH_EMPTY, 0},
+};
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+# Generates codepages_hash.h, a perfect hash of every charset alias within
+# codepages.h, for iconv.c's find_charmap. Run from this directory after
+# editing codepages.h:
+#
+#   python3 codepages_hash.py codepages.h > codepages_hash.h
+#
+# Each alias is hashed by FNV-1a into a bucket, and each bucket is assigned
+# the seed that places all of its aliases into free slots under a second
+# FNV-1a pass. Lookups thus cost two hashes and a single comparison.
+
+import re
+import sys
+
+BUCKETS = 32
+SLOTS = 128
+EMPTY = 0xFFFF
+
+
+def fnv1a(data, seed):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in data:
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def c_string(literal):
+    """Decodes the escapes used within codepages.h."""
+    out = bytearray()
+    i = 0
+    while i < len(literal):
+        if literal[i] != "\\":
+            out.append(ord(literal[i]))
+            i += 1
+            continue
+        octal = re.match(r"[0-7]{1,3}", literal[i + 1 :])
+        if octal is None:
+            sys.exit("unsupported escape \\%s" % literal[i + 1])
+        out.append(int(octal.group(), 8))
+        i += 1 + len(octal.group())
+    return out
+
+
+def read_charmaps(path):
+    with open(path) as f:
+        source = f.read()
+    start = source.index("charmaps[] =")
+    body = source[start : source.index(";", start)]
+    data = bytearray()
+    for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', body):
+        data += c_string(literal)
+    # The implicit terminator of the array.
+    data.append(0)
+    return data
+
+
+def read_aliases(charmaps):
+    """Walks charmaps as find_charmap does, returning (alias, name offset,
+    charmap offset) for every alias."""
+    aliases = []
+    s = 0
+    while charmaps[s]:
+        names = []
+        while charmaps[s]:
+            end = charmaps.index(0, s)
+            names.append((bytes(charmaps[s:end]), s))
+            s = end + 1
+        for name, offset in names:
+            aliases.append((name, offset, s + 1))
+        if charmaps[s + 1] > 0o200:
+            s += 2
+        else:
+            s += 2 + (64 - charmaps[s + 1]) * 5
+    return aliases
+
+
+def place(aliases):
+    buckets = [[] for _ in range(BUCKETS)]
+    for alias in aliases:
+        buckets[fnv1a(alias[0], 0) % BUCKETS].append(alias)
+
+    seeds = [0] * BUCKETS
+    slots = [None] * SLOTS
+    # Place the largest buckets first, while the most slots are free.
+    for bucket in sorted(range(BUCKETS), key=lambda b: -len(buckets[b])):
+        for seed in range(256):
+            wanted = [fnv1a(a[0], seed) % SLOTS for a in buckets[bucket]]
+            if len(set(wanted)) == len(wanted) and all(
+                slots[w] is None for w in wanted
+            ):
+                break
+        else:
+            sys.exit("no seed places bucket %d; raise SLOTS" % bucket)
+        seeds[bucket] = seed
+        for slot, alias in zip(wanted, buckets[bucket]):
+            slots[slot] = alias
+    return seeds, slots
+
+
+def main():
+    charmaps = read_charmaps(sys.argv[1])
+    aliases = read_aliases(charmaps)
+
+    names = [a[0] for a in aliases]
+    if len(set(names)) != len(names):
+        sys.exit("duplicate alias within codepages.h")
+    for name in names:
+        if not re.fullmatch(rb"[a-z0-9]+", name):
+            sys.exit("alias %s is not normalized" % name.decode())
+    if len(charmaps) > EMPTY:
+        sys.exit("charmaps no longer fits 16 bit offsets")
+
+    seeds, slots = place(aliases)
+
+    out = []
+    emit = out.append
+    emit(
+        "/* This is a generated file! Please edit codepages.h and use "
+        "codepages_hash.py to rebuild */"
+    )
+    emit("")
+    emit("#define CHARMAP_HASH_BUCKETS %d" % BUCKETS)
+    emit("#define CHARMAP_HASH_SLOTS %d" % SLOTS)
+    emit("#define CHARMAP_HASH_EMPTY 0x%X" % EMPTY)
+    emit("#define CHARMAP_NAME_MAX %d" % max(len(n) for n in names))
+    emit("")
+    emit("_Static_assert(sizeof charmaps == %d," % len(charmaps))
+    emit('               "codepages_hash.h is out of date with codepages.h");')
+    emit("")
+    emit("static const unsigned char charmap_hash_seeds[CHARMAP_HASH_BUCKETS] = {")
+    for i in range(0, BUCKETS, 12):
+        emit("    " + " ".join("%d," % s for s in seeds[i : i + 12]))
+    emit("};")
+    emit("")
+    emit("/* Offsets of each slot's alias and charmap within charmaps. */")
+    emit("static const struct {")
+    emit("    unsigned short name, charmap;")
+    emit("} charmap_hash_slots[CHARMAP_HASH_SLOTS] = {")
+    for slot in slots:
+        if slot is None:
+            emit("    {CHARMAP_HASH_EMPTY, 0},")
+        else:
+            emit("    {%d, %d}, /* %s */" % (slot[1], slot[2], slot[0].decode()))
+    emit("};")
+
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
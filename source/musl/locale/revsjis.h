@@ -0,0 +1,2629 @@
+/* This is a generated file! Please edit jis0208.h and use revsjis.py to rebuild */
+
+/* Page of each code point's high byte within rev_sjis. */
+static const unsigned char rev_sjis_index[256] = {
+    1, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 5, 6, 7, 0, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44,
+    45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60,
+    61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+    77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+};
+
+static const unsigned short rev_sjis[94][256] = {
+    {0},
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 33119, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 33169, 33170, 0, 0, 0, 33176, 33102, 0,
+        0, 0, 33226, 0, 0, 0, 33163, 33149, 0, 0,
+        33100, 0, 33271, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 33150, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 33152, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 33695, 33696, 33697, 33698, 33699,
+        33700, 33701, 33702, 33703, 33704, 33705, 33706, 33707, 33708, 33709,
+        33710, 33711, 0, 33712, 33713, 33714, 33715, 33716, 33717, 33718,
+        0, 0, 0, 0, 0, 0, 0, 33727, 33728, 33729,
+        33730, 33731, 33732, 33733, 33734, 33735, 33736, 33737, 33738, 33739,
+        33740, 33741, 33742, 33743, 0, 33744, 33745, 33746, 33747, 33748,
+        33749, 33750, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 33862, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 33856, 33857, 33858, 33859,
+        33860, 33861, 33863, 33864, 33865, 33866, 33867, 33868, 33869, 33870,
+        33871, 33872, 33873, 33874, 33875, 33876, 33877, 33878, 33879, 33880,
+        33881, 33882, 33883, 33884, 33885, 33886, 33887, 33888, 33904, 33905,
+        33906, 33907, 33908, 33909, 33911, 33912, 33913, 33914, 33915, 33916,
+        33917, 33918, 33920, 33921, 33922, 33923, 33924, 33925, 33926, 33927,
+        33928, 33929, 33930, 33931, 33932, 33933, 33934, 33935, 33936, 33937,
+        0, 33910, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 33117, 0, 0, 0,
+        0, 33116, 33121, 0, 33125, 33126, 0, 0, 33127, 33128,
+        0, 0, 33269, 33270, 0, 0, 0, 33124, 33123, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 33265, 0,
+        33164, 33165, 0, 0, 0, 0, 0, 0, 0, 33190,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 33166, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 33264, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 33193, 33194, 33192, 33195, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        33227, 0, 33228, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        33229, 0, 33245, 33230, 0, 0, 0, 33246, 33208, 0,
+        0, 33209, 0, 0, 0, 0, 0, 0, 33148, 0,
+        0, 0, 0, 0, 0, 0, 33251, 0, 0, 33253,
+        33159, 0, 33242, 0, 0, 0, 0, 0, 0, 33224,
+        33225, 33215, 33214, 33255, 33256, 0, 0, 0, 0, 0,
+        0, 0, 33160, 33254, 0, 0, 0, 0, 0, 0,
+        0, 33252, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 33248, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 33154, 33247, 0, 0,
+        0, 0, 33157, 33158, 0, 0, 33249, 33250, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        33212, 33213, 0, 0, 33210, 33211, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 33243, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 33244, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        33951, 33962, 33952, 33963, 0, 0, 0, 0, 0, 0,
+        0, 0, 33953, 0, 0, 33964, 33954, 0, 0, 33965,
+        33956, 0, 0, 33967, 33955, 0, 0, 33966, 33957, 33978,
+        0, 0, 33973, 0, 0, 33968, 33959, 33980, 0, 0,
+        33975, 0, 0, 33970, 33958, 0, 0, 33974, 33979, 0,
+        0, 33969, 33960, 0, 0, 33976, 33981, 0, 0, 33971,
+        33961, 0, 0, 33977, 0, 0, 33982, 0, 0, 0,
+        0, 0, 0, 0, 0, 33972, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        33185, 33184, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 33187, 33186,
+        0, 0, 0, 0, 0, 0, 0, 0, 33189, 33188,
+        0, 0, 0, 0, 0, 0, 0, 0, 33183, 33182,
+        0, 0, 0, 33179, 0, 0, 33181, 33180, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 33276,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 33178, 33177, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 33162, 0, 33161, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 33268, 0, 0, 33267,
+        0, 33266, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        33088, 33089, 33090, 33110, 0, 33112, 33113, 33114, 33137, 33138,
+        33139, 33140, 33141, 33142, 33143, 33144, 33145, 33146, 33191, 33196,
+        33131, 33132, 0, 0, 0, 0, 0, 0, 33120, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 33439, 33440, 33441, 33442, 33443,
+        33444, 33445, 33446, 33447, 33448, 33449, 33450, 33451, 33452, 33453,
+        33454, 33455, 33456, 33457, 33458, 33459, 33460, 33461, 33462, 33463,
+        33464, 33465, 33466, 33467, 33468, 33469, 33470, 33471, 33472, 33473,
+        33474, 33475, 33476, 33477, 33478, 33479, 33480, 33481, 33482, 33483,
+        33484, 33485, 33486, 33487, 33488, 33489, 33490, 33491, 33492, 33493,
+        33494, 33495, 33496, 33497, 33498, 33499, 33500, 33501, 33502, 33503,
+        33504, 33505, 33506, 33507, 33508, 33509, 33510, 33511, 33512, 33513,
+        33514, 33515, 33516, 33517, 33518, 33519, 33520, 33521, 0, 0,
+        0, 0, 0, 0, 0, 33098, 33099, 33108, 33109, 0,
+        0, 33600, 33601, 33602, 33603, 33604, 33605, 33606, 33607, 33608,
+        33609, 33610, 33611, 33612, 33613, 33614, 33615, 33616, 33617, 33618,
+        33619, 33620, 33621, 33622, 33623, 33624, 33625, 33626, 33627, 33628,
+        33629, 33630, 33631, 33632, 33633, 33634, 33635, 33636, 33637, 33638,
+        33639, 33640, 33641, 33642, 33643, 33644, 33645, 33646, 33647, 33648,
+        33649, 33650, 33651, 33652, 33653, 33654, 33655, 33656, 33657, 33658,
+        33659, 33660, 33661, 33662, 33664, 33665, 33666, 33667, 33668, 33669,
+        33670, 33671, 33672, 33673, 33674, 33675, 33676, 33677, 33678, 33679,
+        33680, 33681, 33682, 33683, 33684, 33685, 33686, 0, 0, 0,
+        0, 33093, 33115, 33106, 33107, 0,
+    },
+    {
+        35050, 37530, 0, 36533, 0, 0, 0, 38556, 36836, 36431,
+        36835, 35258, 0, 38259, 38750, 0, 39072, 35150, 0, 0,
+        35470, 39073, 37026, 39360, 35701, 38328, 0, 0, 0, 0,
+        36837, 0, 0, 38844, 0, 0, 0, 0, 38336, 0,
+        0, 0, 39074, 0, 0, 37510, 0, 0, 0, 39075,
+        35832, 0, 0, 0, 39076, 0, 35547, 37455, 0, 36581,
+        39077, 0, 0, 39078, 0, 0, 39079, 37972, 0, 35702,
+        0, 0, 0, 0, 0, 37974, 0, 37857, 36033, 38482,
+        0, 0, 0, 0, 0, 58728, 39080, 36838, 39081, 35251,
+        0, 0, 0, 35811, 36078, 38631, 0, 0, 39844, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 38800, 0, 37883, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 35491, 0, 35668, 0,
+        39082, 0, 0, 39083, 38841, 0, 38748, 37256, 39085, 36502,
+        37873, 0, 39088, 0, 0, 35165, 36061, 0, 36060, 35044,
+        0, 0, 39018, 39017, 0, 36273, 34975, 0, 39089, 39090,
+        39091, 38483, 39092, 0, 36080, 35045, 38546, 0, 35740, 0,
+        0, 35741, 35742, 37600, 38842, 0, 39093, 0, 0, 39094,
+        0, 0, 39095, 0, 0, 0, 36972, 0, 0, 0,
+        0, 0, 36697, 36973, 39100, 0, 39098, 0, 39099, 35703,
+        0, 0, 36257, 35310, 0, 39097, 39096, 38311, 0, 0,
+        0, 0, 36453, 36452, 37308, 39101, 38260, 37093, 0, 0,
+        0, 33111, 39102, 39104, 0, 0, 0, 37347, 38879, 35016,
+        0, 0, 0, 0, 0, 0, 0, 39103, 35260, 0,
+        35778, 0, 37511, 0, 0, 0, 35983, 39105, 0, 0,
+        0, 37955, 0, 0, 0, 0,
+    },
+    {
+        0, 35561, 0, 0, 0, 0, 0, 0, 0, 39106,
+        35017, 0, 0, 36062, 35562, 38298, 38064, 35704, 0, 0,
+        0, 0, 0, 0, 0, 0, 35311, 0, 39141, 37728,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38028, 39108, 0,
+        0, 0, 38074, 0, 38880, 0, 36940, 0, 36454, 0,
+        36503, 35262, 0, 0, 0, 0, 0, 37583, 0, 0,
+        37441, 39112, 0, 0, 0, 0, 0, 35018, 37601, 36698,
+        36274, 38723, 0, 37324, 0, 35261, 0, 39111, 0, 38749,
+        39107, 39109, 36332, 39110, 39747, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 39118, 0, 0, 0, 0,
+        0, 39121, 39119, 0, 0, 35264, 0, 38329, 39113, 0,
+        0, 0, 0, 39117, 36081, 0, 0, 36455, 0, 0,
+        0, 35492, 0, 0, 39122, 0, 39114, 0, 0, 38881,
+        0, 36504, 0, 39115, 0, 39120, 0, 0, 0, 0,
+        39123, 0, 39116, 0, 0, 35743, 0, 35019, 0, 0,
+        35744, 35263, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39748, 0, 38553, 38286, 36082, 0, 0, 0, 0,
+        0, 36942, 38837, 0, 0, 0, 0, 0, 0, 0,
+        0, 38358, 0, 0, 35927, 37283, 35298, 0, 0, 0,
+        0, 0, 36722, 0, 0, 0, 39127, 0, 39132, 39130,
+        0, 0, 39125, 0, 0, 37293, 39128, 0, 39131, 39129,
+        0, 38363, 0, 39126, 0, 36941, 0, 38547, 39133, 39134,
+        0, 0, 0, 0, 0, 0, 0, 0, 36675, 39147,
+        0, 0, 0, 37999, 0, 38229, 39142, 0, 38382, 0,
+        35252, 0, 0, 0, 39146, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 39140, 39149, 0, 0, 37233,
+        0, 36034, 0, 38011, 0, 57541, 0, 39148, 37756, 0,
+        39137, 0, 36084, 0, 0, 36083, 39135, 0, 0, 0,
+        0, 36568, 0, 39143, 0, 38381, 37484, 39139, 35985, 0,
+        39136, 39144, 39138, 38863, 39145, 39008, 0, 0, 0, 0,
+        0, 0, 0, 0, 35812, 0, 0, 35984, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 39150, 0, 0,
+        0, 39151, 39155, 35020, 0, 0, 0, 0, 0, 38350,
+        39154, 0, 0, 0, 0, 39153, 39157, 0, 0, 0,
+        39156, 0, 37602, 0, 0, 0, 0, 0, 0, 0,
+        0, 35986, 0, 0, 0, 0, 0, 0, 39158, 0,
+        0, 0, 0, 0, 36547, 0, 37284, 37603, 35828, 0,
+        39159, 0, 0, 0, 0, 35669, 0, 0, 39160, 0,
+        0, 0, 0, 39162, 0, 0, 0, 0, 0, 0,
+        0, 38484, 0, 0, 0, 35974, 0, 0, 0, 0,
+        0, 0, 36432, 38133, 39161, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 36291, 38754, 0, 0, 0, 0, 39164, 39234,
+        39163, 36290, 0, 36765, 0, 0, 0, 0, 0, 0,
+        35928, 0, 0, 0, 39235, 0, 0, 35789, 0, 0,
+        0, 39232, 39233, 0, 0, 37805, 0, 37276, 0, 35745,
+        0, 0, 0, 38508, 39236, 0, 0, 0, 38843, 0,
+        0, 0, 39237, 0, 0, 0, 0, 39240, 0, 39238,
+        0, 37229, 0, 0, 0, 0, 0, 39239, 39241, 0,
+        0, 0, 0, 0, 0, 39243, 0, 0, 0, 39242,
+        0, 38342, 0, 0, 0, 0,
+    },
+    {
+        35670, 39245, 39246, 0, 35245, 0, 0, 0, 0, 39244,
+        0, 0, 0, 0, 0, 0, 0, 0, 36594, 0,
+        39249, 39248, 39247, 0, 39124, 0, 39250, 0, 0, 0,
+        0, 36766, 0, 39251, 0, 0, 0, 0, 0, 0,
+        0, 0, 38724, 0, 0, 0, 0, 0, 0, 0,
+        38615, 0, 0, 0, 0, 39253, 0, 0, 39252, 39255,
+        39254, 0, 0, 39256, 39257, 35058, 0, 36019, 35930, 36699,
+        37531, 35746, 37094, 36085, 0, 36238, 39259, 38598, 37733, 0,
+        36505, 0, 39258, 0, 39260, 0, 0, 0, 0, 0,
+        37757, 0, 35477, 0, 0, 0, 0, 0, 39261, 0,
+        0, 37884, 0, 0, 37203, 39263, 39264, 38058, 36086, 39002,
+        39265, 0, 0, 35748, 0, 0, 0, 38330, 37300, 35823,
+        37716, 0, 0, 0, 35987, 0, 0, 0, 39266, 0,
+        39267, 0, 0, 37856, 35198, 0, 0, 39270, 36347, 0,
+        39269, 36292, 0, 39271, 58348, 39272, 38496, 39273, 0, 39274,
+        39275, 36839, 0, 36554, 0, 0, 0, 0, 0, 0,
+        35493, 0, 39278, 0, 39276, 38587, 39277, 0, 38265, 39279,
+        39280, 39281, 37758, 0, 0, 0, 39285, 39283, 39284, 39282,
+        36321, 39286, 38632, 38882, 0, 0, 0, 0, 0, 39287,
+        0, 0, 0, 0, 0, 0, 37030, 39288, 36729, 0,
+        0, 39289, 0, 37532, 38845, 37760, 0, 0, 0, 0,
+        0, 0, 0, 0, 39363, 0, 0, 0, 0, 39290,
+        60067, 35779, 0, 0, 39291, 38525, 0, 0, 0, 0,
+        36744, 37370, 0, 39293, 37858, 0, 0, 39294, 0, 0,
+        39296, 35405, 0, 0, 0, 39297, 35749, 0, 37834, 35226,
+        36719, 0, 0, 38047, 39298, 0,
+    },
+    {
+        37761, 0, 0, 36974, 39299, 0, 38314, 37080, 35488, 0,
+        35495, 39300, 0, 0, 39302, 0, 0, 35929, 0, 0,
+        39301, 0, 0, 38897, 0, 0, 0, 0, 0, 36745,
+        0, 0, 0, 0, 0, 0, 38075, 38346, 0, 39303,
+        0, 38808, 39304, 0, 0, 0, 39305, 0, 37790, 0,
+        0, 39306, 0, 0, 37031, 36348, 35988, 39307, 36456, 36239,
+        0, 0, 0, 0, 0, 0, 0, 37604, 39309, 0,
+        0, 37285, 0, 0, 36333, 39310, 39311, 37199, 0, 39308,
+        0, 0, 0, 0, 39313, 0, 38485, 0, 0, 0,
+        0, 36228, 0, 0, 39312, 0, 0, 0, 0, 35989,
+        36316, 38029, 0, 0, 0, 39316, 39314, 0, 0, 0,
+        0, 38299, 36840, 39323, 35460, 39317, 39315, 37230, 0, 0,
+        0, 0, 0, 0, 0, 39319, 0, 39318, 0, 0,
+        0, 35427, 0, 0, 0, 35968, 39324, 38827, 0, 0,
+        0, 39320, 0, 0, 0, 39325, 39322, 0, 39321, 0,
+        0, 0, 0, 0, 0, 38861, 0, 0, 0, 36087,
+        35265, 0, 0, 38898, 0, 0, 0, 0, 0, 36757,
+        37751, 36229, 39328, 39329, 0, 0, 0, 38883, 0, 0,
+        38986, 39331, 0, 0, 0, 36088, 0, 0, 39330, 0,
+        35406, 0, 0, 39332, 0, 38517, 0, 37562, 0, 38725,
+        0, 38359, 0, 0, 0, 39333, 0, 0, 0, 0,
+        59603, 0, 0, 37806, 0, 39334, 35496, 38577, 0, 0,
+        0, 36767, 39335, 38373, 39339, 0, 37032, 39336, 35790, 0,
+        39337, 35497, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 35917, 39340, 0, 39341, 0, 0, 39342, 39343,
+        36569, 0, 0, 0, 36089, 38620,
+    },
+    {
+        0, 38630, 37877, 0, 0, 38383, 39344, 0, 39345, 0,
+        0, 0, 0, 39347, 0, 39349, 39348, 0, 0, 0,
+        0, 39350, 35259, 38507, 0, 36346, 39351, 0, 0, 37240,
+        0, 0, 36768, 35751, 0, 39352, 0, 0, 0, 0,
+        0, 0, 38105, 0, 0, 0, 0, 39353, 0, 39354,
+        0, 39355, 0, 0, 0, 0, 39356, 38211, 35814, 35043,
+        0, 0, 0, 37821, 39357, 36700, 0, 37095, 0, 39359,
+        39358, 36769, 36063, 39361, 38076, 0, 0, 39362, 0, 0,
+        0, 38106, 37298, 37356, 35750, 0, 0, 37868, 37456, 0,
+        38030, 0, 38509, 0, 39364, 0, 37096, 0, 0, 0,
+        0, 0, 35924, 0, 0, 39365, 0, 0, 0, 0,
+        39366, 35147, 35059, 35563, 0, 37286, 35696, 38801, 0, 39369,
+        35253, 0, 0, 39368, 0, 0, 0, 35752, 0, 0,
+        39370, 0, 38639, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39371, 0, 38864, 0, 36090, 0, 0, 0, 0, 36020,
+        39372, 0, 0, 0, 0, 39374, 39373, 0, 36990, 35160,
+        0, 0, 0, 35197, 39375, 0, 39376, 0, 0, 36021,
+        0, 0, 39377, 0, 0, 0, 0, 35726, 0, 0,
+        0, 0, 0, 0, 36433, 39378, 0, 0, 0, 0,
+        38548, 36275, 35705, 38726, 37231, 38077, 36603, 0, 0, 0,
+        0, 0, 36710, 0, 36582, 36595, 0, 36758, 0, 38078,
+        0, 0, 0, 39381, 0, 35170, 37232, 36091, 36035, 35813,
+        0, 0, 39385, 37440, 37372, 35753, 36770, 39386, 39384, 35266,
+        37348, 36534, 36458, 35141, 0, 0, 35472, 36230, 36457, 0,
+        39387, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 39388, 0, 35688, 35429, 0, 0, 0, 36231, 35687,
+        37597, 35140, 37807, 38588, 36160, 38809, 37734, 36092, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 35918, 0, 39397,
+        0, 35809, 38505, 0, 0, 0, 0, 0, 38107, 0,
+        0, 39396, 0, 35548, 39391, 39392, 39394, 0, 0, 0,
+        0, 0, 0, 0, 39395, 0, 35706, 36993, 0, 38315,
+        39393, 39389, 36065, 0, 39390, 0, 38979, 0, 0, 0,
+        38384, 0, 37606, 36064, 36240, 0, 0, 0, 39398, 0,
+        0, 37851, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 39402, 0, 0, 0, 0,
+        0, 0, 0, 0, 36604, 0, 36596, 0, 0, 0,
+        0, 0, 39405, 39403, 0, 38561, 0, 39400, 39409, 39404,
+        0, 0, 0, 39407, 36036, 38589, 0, 0, 39408, 0,
+        0, 0, 39410, 0, 39412, 0, 0, 0, 0, 36334,
+        39009, 0, 39401, 39399, 39411, 0, 39406, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39414, 0, 39490, 39416, 0, 0, 39420, 0,
+        0, 39488, 39417, 0, 0, 39517, 0, 0, 36327, 35408,
+        0, 0, 0, 0, 39415, 0, 0, 0, 39492, 35060,
+        39491, 0, 34979, 38249, 39489, 0, 39418, 0, 0, 39413,
+        39419, 36294, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 39493, 0, 0, 0,
+        0, 0, 0, 0, 0, 35061, 39502, 0, 0, 39494,
+        39495, 0, 36771, 38537, 0, 0, 0, 39500, 39499, 0,
+        0, 0, 37710, 0, 0, 0, 0, 0, 0, 0,
+        39501, 0, 0, 39498, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 35155, 0, 36276, 36943, 0, 0,
+        0, 0, 0, 0, 0, 39496, 37762, 0, 0, 0,
+        39497, 0, 34976, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 39507, 38722, 0, 36773,
+        0, 39513, 0, 0, 0, 0, 39512, 39503, 0, 0,
+        0, 0, 37313, 0, 39504, 0, 0, 0, 37357, 39509,
+        36772, 0, 0, 0, 0, 0, 39506, 0, 0, 38626,
+        0, 0, 0, 35931, 0, 0, 39510, 39511, 0, 0,
+        0, 0, 39508, 39514, 0, 0, 0, 0, 0, 39505,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 39520, 39525, 0, 39521, 0, 39516, 0,
+        0, 39526, 37200, 0, 0, 39528, 0, 36161, 39518, 37533,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39522, 39515, 35499, 0, 35564, 35461, 39523, 39519,
+        0, 0, 0, 0, 0, 0, 0, 35990, 39529, 39527,
+        37234, 35689, 35754, 0, 39524, 0, 35826, 0, 0, 0,
+        0, 0, 35171, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 39533, 39531, 0, 39589,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39536, 0, 0, 0, 0, 0, 39530, 0,
+        39534, 0, 0, 39532, 0, 0, 0, 36459, 39535, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 39538, 0, 39543,
+        0, 0, 0, 39541, 39540, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 37457, 0, 0, 35267,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39537, 0, 39539, 36774, 35154, 0, 0, 39542, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 35292, 0, 0, 0, 0, 0, 39554, 0, 36858,
+        39549, 0, 39547, 0, 39548, 0, 39550, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 35164, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 37208, 0, 39544, 0,
+        39545, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 35482, 0, 0, 0, 0, 0, 0, 0, 0,
+        39553, 0, 0, 0, 35565, 0, 39556, 39552, 39555, 0,
+        0, 0, 0, 0, 0, 0, 38316, 0, 0, 0,
+        37843, 0, 38070, 0, 0, 0, 0, 0, 39558, 0,
+        0, 0, 0, 0, 39557, 35428, 0, 0, 39559, 0,
+        0, 0, 0, 39562, 0, 0, 0, 0, 39561, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39560, 0, 37976, 0, 0, 39563, 0, 0, 0, 0,
+        0, 0, 0, 0, 39564, 0, 0, 0, 0, 0,
+        39566, 0, 39565, 0, 0, 0, 0, 0, 39568, 0,
+        0, 0, 39571, 39569, 39567, 39570, 0, 0, 0, 0,
+        39572, 0, 0, 0, 0, 0, 39573, 0, 0, 39574,
+        0, 39575, 0, 0, 0, 39576, 39268, 0, 36602, 36460,
+        0, 0, 35313, 0, 35062, 0, 0, 37475, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 39577, 0,
+        36258, 0, 35021, 36989, 0, 0, 0, 0, 0, 39578,
+        36037, 0, 0, 36241, 0, 39580,
+    },
+    {
+        39579, 0, 0, 38366, 39581, 0, 0, 0, 39583, 39582,
+        0, 39584, 0, 39585, 0, 35991, 0, 0, 35200, 39586,
+        0, 0, 39588, 0, 39587, 0, 0, 0, 39590, 0,
+        0, 37753, 0, 0, 0, 0, 0, 0, 39591, 34995,
+        36317, 0, 0, 0, 0, 35932, 0, 0, 37486, 0,
+        0, 0, 0, 0, 0, 39592, 39593, 0, 0, 39595,
+        0, 0, 0, 0, 39596, 0, 36322, 0, 0, 0,
+        0, 35791, 0, 0, 38486, 0, 0, 0, 39594, 39597,
+        36287, 36162, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 39601, 0, 0,
+        36259, 0, 37458, 0, 0, 39598, 37592, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 39602, 0, 0,
+        36994, 0, 0, 0, 0, 0, 39600, 39603, 0, 35934,
+        0, 0, 0, 0, 0, 0, 0, 39604, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39605, 0, 36163, 35423, 39607, 0, 0, 0, 0, 0,
+        39608, 0, 0, 0, 0, 0, 39609, 0, 0, 39606,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39599, 0, 0, 39610, 0, 0, 39611, 0,
+        0, 0, 0, 38532, 0, 0, 36841, 0, 0, 0,
+        39613, 39614, 39612, 0, 39616, 0, 0, 0, 0, 0,
+        37975, 0, 0, 35046, 38261, 0, 0, 39617, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 36859, 0, 0, 36535, 0, 38012,
+        35566, 0, 36329, 0, 0, 0,
+    },
+    {
+        38520, 0, 37808, 0, 0, 35992, 37325, 0, 0, 0,
+        39615, 39618, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 37314, 0, 0, 0, 39619, 0, 0, 0, 39620,
+        0, 0, 0, 39622, 0, 0, 37607, 0, 0, 0,
+        0, 0, 35500, 0, 0, 0, 0, 60063, 35201, 38385,
+        0, 0, 36842, 37735, 0, 0, 0, 0, 36324, 0,
+        0, 39628, 0, 0, 38331, 38875, 0, 0, 0, 0,
+        0, 0, 0, 0, 35314, 39624, 0, 0, 0, 0,
+        0, 37209, 39627, 0, 37763, 0, 0, 37736, 37764, 38071,
+        37579, 0, 0, 0, 36295, 0, 0, 0, 39623, 0,
+        0, 0, 0, 0, 0, 35222, 0, 37717, 0, 0,
+        0, 0, 39625, 0, 39621, 0, 0, 36975, 0, 0,
+        0, 39629, 0, 0, 0, 0, 36717, 0, 0, 0,
+        0, 35755, 0, 39630, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38374, 0, 0,
+        0, 37277, 0, 0, 0, 0, 37572, 0, 0, 39632,
+        0, 0, 0, 0, 0, 0, 0, 0, 38510, 0,
+        0, 39633, 0, 0, 39638, 0, 0, 0, 0, 38317,
+        0, 0, 0, 0, 39637, 39631, 39634, 39636, 0, 0,
+        36260, 0, 0, 38343, 0, 0, 0, 39639, 0, 37476,
+        0, 0, 35315, 0, 36843, 0, 0, 0, 0, 39641,
+        0, 39640, 0, 36232, 0, 39642, 39644, 39643, 0, 0,
+        39646, 0, 39635, 39648, 0, 0, 0, 0, 39647, 39645,
+        0, 0, 0, 0, 0, 36461, 36976, 0, 37235, 39649,
+        37050, 35051, 38020, 0, 0, 0, 0, 37593, 0, 39651,
+        39650, 39652, 39653, 39654, 0, 0,
+    },
+    {
+        0, 0, 39655, 0, 0, 0, 0, 0, 0, 38351,
+        39656, 0, 0, 0, 0, 35268, 39657, 0, 0, 0,
+        0, 38747, 35407, 0, 39367, 36711, 37309, 39658, 38633, 0,
+        0, 0, 0, 0, 38578, 0, 0, 39660, 0, 37349,
+        0, 37718, 37310, 38262, 39661, 39662, 35227, 0, 0, 36536,
+        39663, 0, 0, 0, 0, 35022, 39664, 0, 0, 0,
+        0, 0, 39665, 0, 0, 0, 0, 0, 35202, 0,
+        0, 35567, 37854, 38386, 0, 0, 0, 0, 39669, 37236,
+        39668, 35935, 0, 0, 38522, 39667, 0, 37765, 39671, 0,
+        39670, 0, 0, 0, 0, 0, 39673, 0, 39672, 0,
+        0, 35228, 0, 39674, 36775, 39676, 37444, 0, 39675, 0,
+        38321, 0, 0, 0, 0, 36759, 37754, 0, 0, 0,
+        39744, 0, 0, 0, 0, 36164, 0, 0, 0, 39745,
+        37952, 38108, 38607, 0, 0, 0, 0, 0, 37956, 0,
+        0, 39754, 0, 0, 0, 0, 0, 35671, 0, 0,
+        38756, 0, 0, 38573, 0, 39850, 0, 39746, 0, 0,
+        0, 0, 0, 39749, 0, 37315, 0, 0, 38487, 0,
+        0, 0, 37737, 0, 0, 0, 0, 0, 39750, 0,
+        0, 0, 0, 0, 0, 38533, 0, 36296, 0, 0,
+        36776, 0, 0, 0, 0, 0, 0, 0, 39751, 0,
+        0, 36463, 0, 36462, 0, 0, 0, 0, 34999, 36038,
+        0, 37033, 35023, 0, 0, 0, 0, 39755, 39756, 0,
+        39753, 0, 0, 0, 0, 0, 0, 0, 0, 35159,
+        35501, 0, 39752, 0, 38595, 38224, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 34982, 0, 0, 0,
+        0, 35063, 0, 0, 0, 36464,
+    },
+    {
+        0, 35024, 0, 34977, 0, 0, 0, 0, 0, 39761,
+        0, 0, 0, 0, 0, 0, 0, 39759, 0, 0,
+        0, 0, 0, 0, 38586, 0, 39762, 0, 39760, 0,
+        0, 39758, 36944, 0, 0, 0, 0, 39757, 0, 0,
+        0, 38360, 0, 0, 0, 0, 0, 36066, 0, 0,
+        0, 0, 0, 39766, 39767, 0, 0, 0, 0, 0,
+        36777, 0, 0, 0, 39763, 38987, 0, 0, 0, 0,
+        37995, 0, 0, 39765, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        36261, 0, 0, 0, 0, 0, 0, 0, 39768, 0,
+        0, 0, 38263, 0, 0, 0, 39769, 0, 39764, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38585, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 38013, 0, 0, 0,
+        0, 0, 0, 0, 39770, 38225, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 39771, 39775,
+        39772, 0, 0, 35269, 39774, 0, 0, 0, 0, 0,
+        0, 36537, 0, 39773, 35993, 0, 0, 0, 39787, 0,
+        0, 0, 0, 0, 39780, 39777, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 37508, 0, 39776, 0, 0,
+        39778, 0, 0, 39779, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39781, 39782, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 35568,
+        0, 39784, 39783, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39785, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 36844, 0, 0, 0, 0, 0,
+        0, 0, 39788, 0, 37594, 0, 0, 0, 35172, 0,
+        39786, 0, 0, 0, 39789, 0, 0, 0, 0, 0,
+        0, 0, 39790, 0, 39793, 0, 0, 39791, 0, 39792,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        36465, 39794, 0, 0, 36165, 39795, 0, 36506, 37302, 0,
+        39796, 39797, 36473, 36166, 0, 38608, 0, 0, 0, 35655,
+        36039, 39798, 35447, 0, 0, 39799, 0, 37303, 0, 0,
+        0, 0, 39800, 39841, 0, 39801, 0, 39802, 0, 0,
+        39803, 0, 39805, 0, 0, 0, 0, 0, 39806, 0,
+        0, 39808, 0, 37358, 0, 35142, 36583, 35008, 0, 37238,
+        35502, 36531, 0, 36167, 0, 0, 0, 0, 0, 37766,
+        0, 36672, 35503, 37512, 37608, 34998, 35672, 38387, 0, 36544,
+        0, 0, 35697, 37097, 36538, 38727, 39809, 0, 0, 0,
+        0, 0, 0, 0, 35707, 0, 36297, 0, 0, 35409,
+        35203, 36778, 35270, 0, 39810, 38757, 0, 0, 0, 0,
+        0, 36712, 0, 0, 36578, 39811, 35569, 37840, 38567, 39812,
+        0, 39813, 0, 0, 38264, 0, 0, 0, 39815, 0,
+        35494, 35829, 39814, 0, 0, 0, 0, 0, 0, 35504,
+        0, 36945, 39819, 36416, 0, 35271, 39818, 0, 39816, 39820,
+        39817, 37962, 40651, 36946, 0, 39821, 0, 0, 38846, 0,
+        39822, 0, 0, 39824, 0, 37534, 39823, 0, 37025, 0,
+        36507, 0, 0, 0, 37326, 36597,
+    },
+    {
+        0, 38293, 37098, 0, 36555, 39825, 36779, 39826, 39827, 35025,
+        37304, 36977, 0, 39828, 37809, 36780, 0, 36781, 0, 39829,
+        0, 0, 37099, 0, 0, 0, 36782, 0, 0, 0,
+        0, 0, 39830, 0, 39831, 0, 38622, 0, 0, 0,
+        39832, 0, 0, 0, 0, 35780, 0, 0, 0, 36673,
+        0, 0, 0, 0, 0, 0, 39833, 39834, 36570, 36939,
+        37874, 36979, 38134, 37953, 35783, 39835, 0, 0, 0, 35727,
+        39836, 0, 35836, 0, 37837, 35246, 0, 36466, 39837, 39840,
+        39839, 35835, 0, 39838, 0, 37719, 0, 0, 0, 0,
+        0, 0, 0, 0, 37294, 0, 37738, 36550, 0, 0,
+        37239, 38810, 0, 0, 0, 0, 0, 0, 39842, 0,
+        39843, 37844, 0, 36434, 0, 0, 0, 0, 39845, 0,
+        0, 39846, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39847, 0, 0, 0, 35570, 39848, 0, 0, 39849, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 35242, 0, 0, 0, 0, 0, 0, 37210, 35554,
+        0, 39851, 38566, 0, 0, 0, 0, 37328, 0, 35448,
+        0, 0, 39853, 39855, 35549, 0, 0, 39852, 39854, 0,
+        39857, 0, 0, 0, 0, 0, 0, 39856, 0, 39858,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 39859, 0, 0,
+        0, 0, 0, 0, 37819, 35756, 0, 0, 0, 0,
+        0, 0, 35299, 39860, 39865, 0, 0, 39863, 0, 38389,
+        38388, 0, 0, 0, 0, 0, 37767, 0, 0, 0,
+        39862, 36723, 0, 39861, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 37010, 0, 0,
+        0, 39866, 0, 0, 36328, 0, 0, 39872, 0, 0,
+        39873, 39867, 35410, 39868, 39877, 39876, 39875, 39871, 0, 0,
+        0, 39870, 0, 0, 39874, 0, 0, 0, 0, 0,
+        0, 38390, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 39881, 39878, 0, 39880, 0,
+        38802, 0, 39879, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39869, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 37011, 0, 0, 39882, 0,
+        0, 36277, 0, 0, 0, 39883, 0, 0, 39884, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39887, 0, 39886, 0, 0, 39885, 0, 0, 0, 37768,
+        39864, 0, 0, 0, 39893, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 39889, 0, 0,
+        0, 0, 39888, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 39890, 0, 39891, 0, 0, 0, 0, 0,
+        0, 0, 0, 39894, 0, 0, 38884, 0, 39895, 39892,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39896, 0, 0, 35550, 39897, 0, 0, 0, 0,
+        39899, 39898, 0, 0, 39900, 0, 0, 0, 0, 39901,
+        0, 37100, 36674, 0, 0, 36740, 0, 37251, 0, 36168,
+        36278, 36169, 35728, 0, 0, 39902, 0, 0, 36279, 0,
+        0, 36040, 39903, 38564, 37986, 39904, 0, 36170, 0, 0,
+        0, 35498, 0, 37446, 35792, 0,
+    },
+    {
+        0, 0, 36467, 38266, 0, 0, 38079, 0, 0, 0,
+        0, 39905, 35571, 0, 0, 0, 0, 39908, 0, 0,
+        0, 0, 37535, 0, 0, 39907, 39906, 39909, 0, 37609,
+        0, 0, 0, 0, 0, 0, 0, 36995, 0, 0,
+        0, 0, 0, 36468, 0, 37064, 0, 37329, 35649, 0,
+        0, 37536, 0, 0, 39910, 39911, 36845, 0, 0, 0,
+        0, 38488, 0, 0, 39914, 0, 0, 39913, 39912, 38301,
+        0, 39921, 0, 0, 0, 0, 38521, 0, 39915, 0,
+        0, 0, 0, 0, 39917, 38539, 0, 39916, 0, 0,
+        0, 0, 0, 0, 0, 39918, 0, 38054, 39919, 38332,
+        39920, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 35505, 38333, 37966, 39922, 39923, 0,
+        36171, 35506, 39924, 36022, 38755, 38728, 35572, 39926, 0, 37537,
+        0, 36172, 36783, 0, 0, 38109, 0, 0, 36784, 0,
+        0, 0, 0, 36760, 0, 0, 0, 0, 0, 37610,
+        38391, 37720, 0, 0, 36173, 0, 38267, 0, 0, 0,
+        39927, 0, 0, 0, 0, 0, 37752, 36288, 0, 0,
+        0, 36041, 0, 37611, 0, 0, 0, 0, 0, 0,
+        0, 35009, 36750, 36174, 38758, 0, 0, 0, 0, 0,
+        0, 0, 0, 39928, 39929, 38000, 0, 0, 0, 0,
+        39930, 38901, 38988, 0, 0, 0, 0, 39932, 39931, 0,
+        0, 35430, 0, 0, 40000, 0, 0, 0, 40003, 40004,
+        0, 40002, 0, 38239, 36785, 40006, 40005, 40001, 0, 0,
+        0, 0, 40007, 40008, 0, 0, 40009, 0, 0, 0,
+        40012, 40010, 0, 40011, 40013, 0, 35204, 37612, 40014, 0,
+        35994, 35316, 37973, 0, 40015, 37881,
+    },
+    {
+        0, 38361, 0, 40016, 38989, 0, 0, 0, 0, 40017,
+        38334, 40020, 39071, 39087, 0, 36526, 37875, 40021, 0, 35708,
+        37538, 35064, 40022, 38308, 36175, 0, 0, 37487, 0, 0,
+        0, 37613, 0, 0, 0, 0, 0, 38637, 36023, 36042,
+        0, 40023, 0, 0, 0, 40024, 0, 40030, 0, 36579,
+        0, 0, 0, 37539, 0, 35757, 40025, 0, 0, 0,
+        38218, 0, 37477, 0, 0, 40026, 0, 0, 0, 0,
+        0, 0, 40027, 0, 35758, 0, 40028, 0, 40029, 0,
+        0, 40031, 0, 37782, 0, 0, 40032, 40033, 0, 40034,
+        0, 0, 40019, 40018, 0, 0, 0, 40035, 35936, 0,
+        0, 0, 38214, 0, 0, 36298, 38230, 37540, 38250, 40036,
+        0, 0, 36786, 35173, 0, 40037, 0, 0, 0, 40038,
+        0, 38640, 0, 0, 38110, 0, 0, 40041, 35229, 37034,
+        40040, 40039, 35937, 37330, 0, 40045, 40043, 0, 40042, 38821,
+        36067, 0, 0, 0, 36761, 40044, 37739, 36701, 0, 0,
+        0, 37822, 40048, 40047, 0, 0, 0, 0, 40046, 0,
+        40049, 36068, 0, 0, 0, 0, 0, 0, 40050, 38300,
+        36730, 0, 0, 40051, 38135, 0, 0, 0, 0, 37823,
+        37541, 0, 0, 0, 0, 37711, 0, 0, 40052, 35658,
+        0, 0, 0, 0, 0, 36947, 0, 38219, 0, 0,
+        0, 0, 0, 0, 35573, 37957, 0, 0, 0, 0,
+        0, 0, 0, 0, 40053, 36469, 38489, 38490, 0, 0,
+        35230, 40058, 0, 0, 37513, 0, 0, 0, 40055, 0,
+        0, 0, 0, 0, 0, 35317, 0, 0, 0, 0,
+        40107, 40057, 0, 0, 0, 37967, 0, 0, 40056, 0,
+        0, 40054, 0, 36250, 0, 40060,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40067, 40073, 40065, 0, 37755, 0,
+        0, 40070, 38268, 0, 0, 40064, 0, 40069, 38885, 36470,
+        0, 0, 37331, 40061, 0, 0, 0, 35709, 40072, 37035,
+        35205, 40066, 35318, 40071, 0, 0, 0, 35759, 0, 40068,
+        0, 0, 0, 0, 0, 0, 0, 0, 40074, 0,
+        0, 0, 0, 0, 0, 40076, 40086, 40084, 0, 0,
+        40081, 0, 0, 0, 40080, 38902, 0, 40082, 0, 0,
+        35760, 0, 36176, 0, 0, 36762, 0, 0, 0, 40089,
+        40075, 0, 0, 0, 0, 40079, 40062, 0, 35320, 40083,
+        40085, 37488, 0, 0, 36262, 35254, 40077, 40088, 40087, 35761,
+        0, 37287, 35462, 0, 0, 0, 0, 35938, 0, 40078,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 40090,
+        0, 40093, 40095, 0, 0, 0, 0, 36539, 0, 40101,
+        37614, 40091, 0, 0, 0, 0, 40099, 0, 35319, 0,
+        40097, 40098, 0, 0, 40094, 40096, 0, 0, 0, 36069,
+        38729, 0, 0, 35507, 0, 0, 35192, 40100, 0, 37977,
+        34987, 0, 0, 0, 0, 0, 0, 0, 38111, 40059,
+        40106, 40110, 38627, 0, 40103, 0, 0, 0, 37769, 40108,
+        0, 0, 0, 0, 0, 0, 0, 36846, 40109, 37845,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 39014,
+        0, 40105, 0, 0, 0, 0, 40111, 0, 36251, 0,
+        37065, 0, 0, 35026, 40104, 40102, 0, 37241, 0, 0,
+        0, 40092, 36435, 0, 0, 0, 0, 0, 0, 0,
+        37316, 40123, 0, 37242, 40118, 0, 40115, 40116, 0, 36580,
+        40119, 40122, 0, 0, 0, 0,
+    },
+    {
+        40117, 36676, 0, 40120, 0, 0, 40114, 0, 38650, 38649,
+        0, 0, 0, 40124, 40125, 35027, 0, 0, 0, 0,
+        0, 40113, 0, 0, 0, 0, 35824, 34980, 0, 0,
+        0, 35508, 0, 40121, 0, 0, 0, 0, 0, 40129,
+        40128, 0, 0, 0, 40133, 0, 0, 0, 0, 0,
+        0, 0, 40134, 0, 0, 0, 0, 0, 0, 0,
+        40132, 40135, 40127, 40131, 0, 0, 40136, 0, 40137, 0,
+        0, 40126, 36508, 0, 40130, 37332, 36177, 40112, 36948, 0,
+        0, 0, 0, 40150, 0, 38375, 0, 0, 40140, 40141,
+        40142, 0, 0, 40149, 0, 40148, 0, 0, 38557, 35509,
+        0, 40146, 0, 35940, 35411, 0, 0, 40143, 0, 0,
+        38838, 40145, 35028, 40147, 0, 40138, 40144, 40151, 35939, 40139,
+        0, 0, 0, 0, 0, 0, 38780, 0, 0, 0,
+        38730, 0, 0, 0, 0, 40154, 0, 0, 40158, 0,
+        0, 0, 37278, 0, 38903, 40159, 0, 0, 40156, 0,
+        40153, 0, 0, 40152, 40157, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 38318, 0, 0, 37810, 0, 35941,
+        0, 40160, 40155, 0, 40161, 0, 0, 0, 35995, 0,
+        0, 0, 35247, 0, 0, 0, 40169, 0, 0, 0,
+        35510, 0, 0, 0, 0, 40167, 0, 0, 40168, 36263,
+        40166, 40164, 40163, 40170, 40162, 40172, 0, 0, 35321, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40174, 0, 0,
+        40173, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 37542, 0, 40177, 0, 40175, 40165, 35996, 0,
+        40176, 0, 40180, 40179, 40181, 40178,
+    },
+    {
+        40182, 0, 0, 0, 0, 0, 0, 0, 40183, 40184,
+        38376, 0, 40186, 40185, 36702, 0, 37036, 35300, 35322, 0,
+        40187, 0, 35005, 0, 0, 0, 37066, 40188, 0, 59073,
+        40256, 35969, 0, 40257, 0, 0, 0, 0, 37101, 0,
+        0, 0, 40258, 0, 0, 0, 40259, 35673, 40260, 0,
+        40261, 40262, 37333, 0, 0, 0, 36043, 0, 0, 38623,
+        0, 0, 0, 38491, 36746, 40263, 0, 0, 0, 0,
+        0, 37102, 59323, 38112, 0, 36584, 0, 36299, 40264, 0,
+        0, 0, 0, 37317, 0, 38309, 0, 0, 37359, 0,
+        0, 40267, 0, 0, 40265, 0, 40268, 0, 0, 40266,
+        0, 0, 0, 0, 40269, 0, 0, 0, 0, 0,
+        38319, 0, 0, 34997, 0, 0, 0, 0, 38269, 0,
+        0, 38113, 0, 0, 40270, 0, 40273, 36787, 35674, 0,
+        40271, 40278, 36788, 0, 0, 0, 0, 40272, 37987, 0,
+        0, 0, 0, 0, 0, 38781, 40274, 40275, 40279, 37770,
+        40276, 36178, 37084, 0, 0, 40293, 38066, 0, 37360, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 38114, 40363, 0, 0, 0, 0, 38392, 0, 0,
+        0, 37615, 0, 0, 0, 38549, 0, 40282, 35231, 37514,
+        0, 0, 0, 0, 40291, 0, 0, 37459, 40285, 40292,
+        40287, 40294, 40290, 0, 40289, 38031, 0, 40283, 35323, 40281,
+        35729, 37361, 40277, 0, 0, 40280, 36179, 37081, 0, 36789,
+        40288, 38001, 0, 0, 35730, 35431, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 35463, 36928, 40296, 40301,
+        0, 40297, 0, 35997, 0, 40302, 36417, 36233, 0, 0,
+        0, 0, 0, 0, 36677, 40284,
+    },
+    {
+        0, 36509, 40299, 0, 0, 0, 0, 36471, 40300, 35010,
+        0, 0, 40295, 0, 0, 0, 0, 37543, 0, 0,
+        0, 0, 0, 0, 0, 35731, 0, 0, 0, 0,
+        0, 35762, 0, 0, 0, 0, 0, 0, 0, 40298,
+        34981, 0, 0, 36289, 0, 0, 0, 36949, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 37616, 0,
+        0, 38098, 40304, 37245, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 37288, 0, 0, 36426, 40305, 0, 40307,
+        40303, 0, 0, 0, 0, 38367, 0, 37563, 0, 0,
+        0, 0, 37243, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 38393, 36556, 40320, 0, 40318, 0, 0,
+        37016, 0, 0, 0, 35998, 0, 0, 0, 40312, 36791,
+        0, 0, 37862, 37968, 0, 0, 0, 0, 40310, 0,
+        0, 37244, 0, 0, 0, 0, 36598, 40315, 0, 0,
+        36790, 0, 40309, 40314, 0, 0, 38002, 0, 0, 0,
+        40308, 0, 35904, 0, 0, 35452, 0, 0, 0, 40316,
+        38825, 36300, 37460, 40313, 0, 37082, 0, 36180, 36996, 35206,
+        37211, 40311, 35684, 0, 0, 0, 0, 0, 35942, 0,
+        37581, 40317, 0, 0, 0, 0, 0, 37246, 0, 0,
+        40321, 0, 40323, 0, 0, 37301, 40329, 0, 40324, 0,
+        0, 40326, 0, 0, 0, 0, 0, 38240, 37617, 0,
+        40327, 0, 0, 0, 38731, 0, 0, 0, 38759, 35511,
+        0, 0, 0, 0, 0, 34988, 0, 40325, 0, 0,
+        0, 0, 0, 40322, 0, 0, 0, 0, 35574, 0,
+        0, 0, 0, 0, 35207, 0, 40328, 0, 0, 0,
+        38760, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 40332, 0, 0, 0,
+        0, 0, 0, 37305, 0, 40339, 0, 0, 0, 40333,
+        0, 0, 40330, 40337, 0, 0, 0, 0, 40306, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 40334, 0,
+        40338, 0, 0, 0, 38080, 37771, 0, 0, 0, 0,
+        0, 0, 40331, 0, 40335, 0, 0, 0, 35943, 0,
+        0, 0, 36335, 0, 0, 0, 37083, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 40343, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 37701, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40340, 0, 38528, 0, 0, 0, 0,
+        0, 40341, 0, 0, 0, 0, 0, 0, 40342, 0,
+        38604, 0, 37024, 0, 0, 0, 0, 0, 0, 0,
+        0, 35970, 0, 0, 0, 0, 40349, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 36436, 40346, 0, 40345,
+        0, 0, 0, 0, 37969, 0, 0, 0, 37811, 0,
+        0, 0, 0, 0, 37712, 40347, 0, 0, 0, 40348,
+        0, 38287, 0, 37988, 36418, 0, 37103, 0, 38511, 0,
+        0, 0, 0, 0, 0, 35432, 0, 40355, 40350, 0,
+        0, 0, 0, 38761, 40357, 0, 0, 40353, 0, 40354,
+        0, 0, 0, 0, 0, 37248, 0, 0, 0, 0,
+        40352, 0, 40286, 0, 0, 0, 40356, 0, 40351, 0,
+        0, 0, 0, 0, 40361, 40362, 37702, 40364, 0, 0,
+        36419, 40359, 0, 0, 0, 0, 35675, 0, 0, 40365,
+        0, 40358, 40369, 0, 40368, 0, 40367, 0, 0, 0,
+        40370, 0, 0, 40372, 36847, 0,
+    },
+    {
+        40371, 0, 0, 0, 0, 40375, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40373, 0, 0, 0, 40374, 40336,
+        0, 0, 0, 0, 0, 40377, 40376, 0, 0, 0,
+        0, 0, 40344, 40378, 40366, 0, 0, 36472, 0, 0,
+        0, 0, 40379, 40380, 40382, 40381, 40383, 35324, 0, 36181,
+        0, 0, 38394, 37037, 0, 0, 0, 0, 0, 36044,
+        0, 0, 40385, 0, 0, 0, 0, 40388, 0, 38257,
+        0, 35710, 0, 0, 0, 40387, 40386, 38003, 40389, 35763,
+        0, 0, 0, 40391, 40390, 0, 0, 0, 35512, 36437,
+        0, 0, 37846, 0, 0, 0, 0, 0, 35944, 0,
+        0, 0, 37012, 0, 40392, 0, 37038, 37703, 0, 38270,
+        40393, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        40394, 40395, 0, 0, 0, 38326, 39804, 37060, 0, 0,
+        38251, 0, 36310, 0, 38115, 38081, 0, 0, 0, 0,
+        0, 37740, 0, 38847, 0, 40397, 36558, 0, 0, 40398,
+        0, 34996, 0, 0, 35794, 37067, 0, 38272, 0, 0,
+        0, 40399, 36449, 37478, 0, 36474, 36950, 0, 0, 0,
+        0, 0, 0, 40400, 0, 38395, 0, 0, 35223, 36475,
+        0, 0, 0, 40403, 0, 40401, 40404, 38839, 40402, 0,
+        0, 0, 0, 37113, 40405, 0, 0, 37296, 0, 0,
+        40406, 0, 0, 0, 0, 35576, 0, 40408, 0, 40407,
+        0, 0, 0, 0, 40409, 40410, 35577, 0, 0, 37882,
+        37461, 35724, 36476, 37249, 0, 0, 36731, 34990, 0, 0,
+        0, 40411, 0, 0, 0, 0, 0, 0, 0, 0,
+        35232, 40415, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 36182, 40414, 0, 0, 36265, 36792, 0, 0,
+        40413, 0, 36793, 0, 38590, 36264, 0, 0, 0, 35029,
+        37068, 0, 0, 0, 0, 0, 0, 0, 40420, 0,
+        0, 37039, 35174, 0, 0, 0, 0, 36724, 0, 38534,
+        36336, 0, 0, 0, 0, 36794, 0, 37029, 0, 0,
+        0, 0, 40419, 40417, 40418, 0, 0, 0, 0, 0,
+        37515, 0, 0, 40517, 0, 40424, 36510, 36183, 40422, 0,
+        0, 0, 0, 40423, 0, 36951, 0, 0, 0, 40421,
+        0, 0, 36430, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40426, 40425, 40430, 0, 0, 40431, 0,
+        40427, 0, 35393, 40428, 40429, 38099, 0, 0, 0, 0,
+        38273, 35945, 40432, 0, 0, 0, 37040, 0, 36795, 0,
+        0, 0, 37489, 0, 0, 0, 0, 0, 0, 35781,
+        0, 40433, 40437, 0, 0, 35273, 40434, 40436, 0, 0,
+        0, 0, 40435, 0, 0, 36747, 0, 0, 0, 0,
+        37479, 35011, 40438, 0, 0, 0, 0, 40439, 0, 0,
+        0, 0, 37544, 0, 0, 0, 38895, 0, 0, 0,
+        0, 36450, 0, 0, 38377, 0, 0, 0, 0, 0,
+        38492, 0, 0, 0, 40513, 40441, 0, 0, 40444, 0,
+        40443, 0, 0, 40440, 0, 0, 40512, 0, 0, 37852,
+        0, 40442, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40514, 0, 0, 36748, 40515, 0,
+        38762, 38040, 0, 0, 40516, 0, 0, 0, 0, 0,
+        40518, 0, 0, 40519, 0, 0, 0, 0, 0, 0,
+        40520, 0, 35784, 35175, 36184, 40521, 0, 40522, 36753, 37250,
+        0, 0, 39382, 37213, 37212, 37334,
+    },
+    {
+        36293, 0, 0, 39152, 0, 0, 0, 0, 35982, 38732,
+        0, 38396, 0, 38302, 0, 40523, 0, 0, 0, 0,
+        36337, 37565, 40524, 38990, 0, 0, 0, 38493, 0, 37545,
+        40525, 35578, 0, 0, 0, 0, 0, 0, 40526, 40527,
+        38616, 0, 38562, 38550, 38523, 36420, 40529, 0, 0, 36585,
+        0, 0, 38512, 0, 40531, 40534, 40533, 0, 35575, 0,
+        0, 35712, 0, 40530, 0, 40532, 0, 0, 0, 0,
+        40535, 0, 0, 37017, 0, 0, 0, 0, 38811, 35015,
+        36318, 37306, 0, 36571, 0, 0, 36849, 0, 0, 40538,
+        0, 0, 37741, 0, 40536, 37289, 40537, 36848, 38619, 40539,
+        40540, 38792, 0, 0, 0, 0, 40545, 0, 0, 36185,
+        0, 38004, 40542, 37772, 40412, 40416, 0, 35694, 0, 37990,
+        0, 0, 0, 0, 40544, 0, 36796, 38082, 0, 0,
+        0, 0, 0, 40550, 0, 38136, 0, 40541, 0, 40547,
+        40546, 0, 0, 0, 37069, 0, 0, 0, 0, 38541,
+        0, 38865, 0, 0, 38535, 0, 35274, 36477, 0, 0,
+        39015, 40549, 37013, 0, 0, 0, 40548, 0, 0, 40543,
+        0, 0, 0, 0, 0, 36045, 0, 0, 0, 40555,
+        40553, 0, 35275, 40551, 40557, 40563, 0, 0, 0, 0,
+        0, 0, 0, 37318, 0, 0, 38335, 0, 40565, 0,
+        0, 0, 38209, 0, 0, 0, 40564, 38032, 38494, 35513,
+        0, 37109, 36703, 0, 0, 0, 37585, 0, 38733, 0,
+        0, 40560, 40559, 0, 0, 0, 40561, 0, 40558, 0,
+        0, 40566, 0, 40556, 0, 0, 40554, 0, 40562, 40552,
+        0, 37516, 0, 38646, 36548, 36338, 0, 0, 0, 0,
+        0, 36280, 0, 0, 38543, 35424,
+    },
+    {
+        0, 0, 37580, 37832, 35176, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 37104,
+        0, 0, 37042, 35913, 0, 0, 0, 0, 0, 0,
+        40568, 0, 0, 36186, 35484, 0, 0, 0, 0, 0,
+        0, 40570, 35476, 40577, 0, 0, 0, 0, 0, 0,
+        40573, 0, 37105, 0, 0, 0, 35434, 36266, 0, 0,
+        35433, 36301, 0, 0, 40571, 35973, 35946, 37773, 0, 0,
+        40569, 0, 35012, 0, 0, 0, 0, 40572, 40574, 0,
+        35787, 35915, 0, 35514, 35690, 0, 0, 0, 0, 40578,
+        0, 0, 36343, 38545, 0, 36438, 0, 0, 0, 40579,
+        0, 0, 0, 38223, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40591, 0, 35249, 40580,
+        0, 0, 0, 0, 0, 0, 40597, 40581, 0, 38848,
+        0, 40588, 0, 38014, 0, 0, 0, 0, 0, 0,
+        0, 40596, 0, 40583, 0, 0, 0, 34994, 40585, 0,
+        0, 36187, 0, 0, 0, 40587, 0, 40586, 0, 40582,
+        40593, 0, 36797, 0, 0, 0, 39659, 36070, 38812, 0,
+        0, 0, 0, 40584, 0, 37618, 35394, 36267, 0, 40576,
+        0, 40592, 35457, 0, 0, 40590, 40594, 0, 37774, 0,
+        0, 0, 0, 0, 0, 0, 35580, 0, 40624, 0,
+        0, 38599, 40599, 35579, 0, 40606, 0, 0, 0, 0,
+        38495, 0, 40607, 40609, 0, 40613, 40601, 0, 37449, 0,
+        0, 0, 0, 37775, 40617, 40604, 0, 40614, 0, 0,
+        0, 40608, 0, 0, 0, 0, 0, 0, 36952, 40618,
+        0, 0, 37041, 0, 0, 0, 0, 0, 0, 40616,
+        35515, 0, 0, 0, 0, 0,
+    },
+    {
+        39023, 40598, 0, 0, 40612, 35030, 0, 0, 40600, 0,
+        0, 38584, 40605, 36929, 37573, 40595, 0, 0, 40611, 0,
+        0, 0, 0, 0, 0, 37018, 40621, 35473, 35999, 0,
+        0, 0, 0, 40623, 40602, 40622, 0, 40615, 40603, 0,
+        40619, 0, 40620, 0, 0, 0, 0, 0, 40637, 0,
+        0, 0, 37836, 0, 40610, 0, 0, 40633, 0, 0,
+        0, 40635, 0, 37590, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 38763, 0, 0, 0, 0, 0,
+        0, 0, 0, 38294, 40630, 37320, 0, 0, 0, 40636,
+        37214, 0, 40627, 40640, 40639, 0, 37869, 40638, 37864, 0,
+        0, 0, 0, 0, 0, 0, 40642, 40629, 0, 35782,
+        40632, 36732, 0, 0, 0, 38016, 40634, 35785, 0, 40626,
+        40628, 40625, 0, 0, 38991, 35449, 40631, 0, 0, 40641,
+        35412, 0, 0, 0, 0, 0, 0, 0, 36325, 0,
+        0, 0, 35196, 0, 0, 40658, 0, 0, 38992, 40661,
+        0, 0, 0, 0, 0, 36953, 40660, 0, 0, 0,
+        40659, 0, 0, 0, 0, 0, 0, 40656, 0, 0,
+        0, 0, 0, 0, 40644, 0, 0, 40673, 40643, 0,
+        40662, 0, 0, 0, 0, 0, 0, 40654, 0, 0,
+        40649, 40646, 0, 40647, 0, 40655, 0, 0, 0, 60064,
+        0, 0, 40652, 36188, 37574, 37252, 40650, 0, 40645, 0,
+        0, 40648, 0, 0, 0, 0, 38764, 38538, 0, 0,
+        0, 40653, 40663, 0, 0, 0, 0, 0, 0, 0,
+        0, 40671, 40664, 0, 0, 40677, 0, 40675, 0, 0,
+        0, 0, 40670, 0, 0, 0, 0, 0, 0, 40669,
+        0, 37582, 0, 37253, 0, 40667,
+    },
+    {
+        0, 0, 40665, 0, 0, 40672, 0, 0, 0, 0,
+        40678, 38131, 40684, 0, 0, 0, 0, 0, 40679, 40682,
+        40676, 0, 0, 37524, 0, 38231, 0, 40666, 0, 0,
+        40674, 36798, 0, 38605, 40694, 40681, 0, 0, 0, 0,
+        0, 36000, 35233, 35454, 0, 0, 40657, 0, 0, 0,
+        0, 0, 0, 36799, 40686, 0, 40693, 36599, 35474, 0,
+        0, 37453, 0, 0, 0, 0, 0, 0, 40683, 0,
+        0, 40688, 40692, 0, 0, 35764, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 35691, 40690,
+        0, 0, 0, 0, 0, 35648, 0, 37833, 40689, 0,
+        0, 0, 40691, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40685, 0, 0, 0, 0, 0,
+        40687, 0, 0, 0, 0, 0, 0, 35456, 37480, 0,
+        0, 0, 40698, 0, 0, 0, 0, 0, 0, 0,
+        0, 40696, 36071, 0, 40695, 0, 0, 0, 0, 0,
+        0, 40768, 0, 0, 0, 0, 40567, 0, 0, 0,
+        40697, 0, 40699, 40700, 0, 0, 0, 0, 0, 0,
+        40779, 0, 40775, 0, 40589, 0, 0, 0, 0, 40774,
+        0, 0, 0, 0, 40773, 0, 0, 40770, 0, 0,
+        0, 0, 0, 40680, 40772, 40771, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 40777,
+        0, 38981, 0, 0, 0, 0, 0, 0, 40780, 35833,
+        0, 0, 40776, 40778, 0, 0, 0, 0, 0, 0,
+        0, 0, 38053, 0, 40781, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        40785, 40782, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 38803, 40783, 0, 0, 0, 0,
+        40668, 0, 0, 0, 0, 0, 0, 0, 40786, 0,
+        0, 0, 40787, 0, 0, 0, 0, 0, 0, 35156,
+        0, 40789, 35975, 36511, 0, 35795, 0, 0, 0, 35234,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        38782, 0, 0, 0, 0, 40791, 40790, 40793, 35676, 0,
+        0, 35796, 35516, 0, 0, 0, 0, 40796, 0, 0,
+        0, 40795, 0, 40797, 0, 0, 35276, 0, 37462, 0,
+        40798, 0, 0, 35517, 40800, 0, 0, 0, 0, 40799,
+        0, 40801, 0, 0, 0, 40802, 0, 40803, 36478, 37043,
+        36255, 0, 38288, 0, 0, 38368, 39011, 0, 0, 0,
+        0, 36501, 0, 0, 0, 36302, 38896, 0, 0, 0,
+        40804, 40805, 0, 36480, 0, 0, 0, 40806, 40807, 0,
+        0, 40809, 40808, 0, 38519, 0, 0, 36733, 36586, 36451,
+        0, 40810, 0, 0, 0, 0, 0, 0, 0, 40812,
+        36930, 0, 40811, 0, 0, 0, 0, 0, 40813, 0,
+        0, 0, 0, 0, 40814, 0, 0, 0, 0, 0,
+        40815, 40816, 0, 0, 0, 40817, 0, 40819, 40818, 40820,
+        35235, 37481, 0, 40821, 0, 0, 36421, 35435, 40822, 0,
+        0, 37729, 39626, 0, 0, 0, 0, 35650, 40823, 0,
+        0, 0, 0, 40824, 0, 38378, 38536, 0, 0, 0,
+        37829, 40825, 38116, 0, 0, 0, 38137, 0, 0, 38609,
+        0, 0, 0, 40826, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40828, 40827, 0, 0, 40830,
+        0, 0, 0, 40829, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 40833, 0,
+        0, 0, 0, 0, 0, 36481, 0, 38575, 0, 40834,
+        40835, 0, 0, 35651, 0, 0, 0, 40836, 0, 0,
+        0, 0, 0, 0, 0, 40838, 40837, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 36997, 0, 0, 38232, 35177, 0, 0, 0,
+        0, 0, 38083, 0, 37619, 36704, 35713, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 38084, 0,
+        36524, 0, 0, 0, 0, 40840, 0, 35518, 0, 0,
+        35224, 0, 0, 37872, 40839, 36189, 37490, 0, 40841, 0,
+        0, 0, 0, 0, 40849, 0, 40842, 0, 0, 0,
+        0, 0, 37311, 0, 35714, 40850, 0, 0, 0, 0,
+        0, 0, 35976, 0, 0, 35652, 40848, 0, 0, 40846,
+        40843, 38784, 0, 0, 0, 0, 37566, 0, 0, 0,
+        37847, 40844, 0, 0, 40852, 0, 40851, 35906, 0, 0,
+        35243, 0, 0, 36281, 40845, 40847, 0, 0, 0, 0,
+        0, 38518, 37362, 0, 0, 0, 0, 0, 0, 0,
+        0, 38551, 0, 0, 40860, 0, 0, 40861, 0, 35277,
+        0, 0, 0, 0, 38310, 38651, 40863, 36513, 36800, 40856,
+        40862, 35208, 0, 35765, 0, 0, 40853, 40858, 0, 0,
+        0, 37106, 38033, 0, 38117, 0, 0, 0, 0, 0,
+        0, 40855, 0, 38464, 0, 40857, 0, 40866, 0, 40864,
+        0, 40859, 0, 0, 0, 38465, 37991, 35715, 0, 37700,
+        0, 0, 37517, 0, 40867, 0, 0, 0, 0, 40865,
+        37335, 40854, 0, 35178, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 38765, 40878, 0, 0, 0, 0, 0, 40877, 0,
+        0, 0, 0, 37108, 0, 40874, 0, 38796, 0, 0,
+        37812, 40868, 0, 0, 0, 0, 0, 37571, 0, 0,
+        0, 35179, 36190, 40871, 0, 0, 0, 0, 0, 0,
+        36678, 40876, 0, 40875, 40870, 0, 40873, 0, 0, 35464,
+        0, 40872, 37992, 0, 0, 38828, 0, 0, 36850, 37107,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 40884,
+        40882, 0, 38252, 0, 0, 0, 0, 0, 0, 40879,
+        40881, 0, 35161, 0, 0, 36191, 38993, 0, 35420, 0,
+        38274, 0, 0, 0, 0, 0, 38785, 0, 0, 35395,
+        36954, 40883, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40888, 0, 0, 36801, 0, 0, 0,
+        38735, 0, 40885, 0, 0, 0, 0, 40880, 0, 40886,
+        0, 0, 0, 38876, 0, 37779, 37824, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 35413, 0, 0, 35188, 0,
+        0, 40892, 0, 0, 40895, 0, 0, 0, 38849, 0,
+        0, 0, 38788, 0, 0, 0, 0, 40902, 40896, 40893,
+        0, 0, 0, 38866, 40899, 0, 0, 0, 0, 36713,
+        40901, 0, 0, 40906, 0, 0, 37777, 40904, 0, 0,
+        0, 0, 40898, 0, 0, 37463, 0, 0, 40905, 0,
+        40894, 0, 40900, 0, 40907, 35066, 40897, 0, 40908, 0,
+        0, 36955, 0, 36734, 0, 38307, 0, 36268, 0, 40889,
+        40903, 37721, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 37044, 0, 35465, 36303, 36802,
+        40891, 36705, 0, 0, 0, 0, 0, 0, 0, 35947,
+        0, 40890, 0, 0, 0, 40912, 36749, 36024, 0, 40927,
+        0, 40921, 35732, 37742, 0, 40916, 40925, 34989, 35153, 0,
+        0, 35255, 0, 40918, 37290, 40909, 40911, 36192, 0, 0,
+        0, 0, 0, 0, 0, 0, 40928, 0, 40923, 0,
+        0, 0, 40915, 0, 0, 0, 0, 40922, 0, 0,
+        0, 0, 0, 0, 38569, 0, 0, 40920, 40924, 0,
+        0, 0, 0, 0, 0, 0, 36046, 0, 36803, 0,
+        0, 37464, 0, 0, 0, 40914, 0, 0, 0, 0,
+        0, 0, 0, 38734, 0, 0, 0, 40917, 0, 0,
+        40910, 37778, 0, 0, 40913, 0, 0, 0, 40919, 0,
+        0, 0, 0, 0, 0, 0, 39024, 36540, 38558, 0,
+        40929, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        38060, 0, 0, 40941, 36025, 0, 0, 0, 0, 0,
+        36736, 0, 40931, 0, 0, 0, 38829, 36193, 0, 40944,
+        0, 0, 35052, 0, 0, 40942, 0, 0, 0, 0,
+        40930, 0, 0, 0, 0, 40936, 0, 0, 40938, 0,
+        0, 0, 38766, 40933, 0, 0, 37709, 0, 0, 40935,
+        0, 0, 0, 0, 40943, 0, 40937, 38597, 0, 0,
+        0, 40932, 0, 36512, 40956, 0, 0, 0, 0, 35466,
+        0, 40934, 40939, 40940, 0, 0, 0, 0, 0, 0,
+        0, 37354, 37336, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40948, 0, 0, 40954,
+        0, 0, 40952, 0, 37704, 0, 0, 57410, 40949, 0,
+        0, 0, 0, 0, 40950, 40926,
+    },
+    {
+        0, 35737, 38233, 0, 0, 0, 36541, 0, 0, 36247,
+        0, 0, 0, 0, 0, 38994, 0, 40946, 0, 57409,
+        35209, 37254, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 38041, 0, 35519, 38904, 0, 0, 0, 0,
+        0, 0, 0, 38559, 37584, 0, 0, 0, 0, 40953,
+        40955, 0, 0, 0, 0, 0, 37201, 0, 0, 0,
+        0, 0, 57408, 40951, 0, 40945, 0, 0, 0, 35521,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 35977, 0, 0, 0, 57422, 0,
+        0, 57417, 37110, 0, 0, 35459, 0, 0, 0, 0,
+        36737, 0, 57426, 0, 0, 0, 0, 0, 0, 57419,
+        37546, 57416, 37591, 0, 0, 0, 57451, 0, 0, 0,
+        57413, 0, 57412, 0, 57421, 0, 0, 0, 57415, 57414,
+        57420, 0, 37023, 0, 57411, 0, 0, 0, 0, 0,
+        0, 0, 57423, 0, 0, 57424, 0, 0, 0, 0,
+        0, 35520, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 57429, 0, 57428, 57430, 0, 0, 0, 0, 0,
+        57433, 0, 0, 0, 0, 0, 0, 37730, 0, 57427,
+        0, 0, 0, 0, 0, 57431, 0, 0, 0, 0,
+        0, 0, 35971, 37367, 57425, 37978, 0, 0, 57432, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57437, 57435, 0, 0, 57438, 0, 0, 57441,
+        0, 0, 0, 57434, 36234, 37959, 0, 0, 40887, 0,
+        0, 0, 0, 0, 0, 38804, 57436, 0, 57440, 37363,
+        0, 57439, 0, 57418, 0, 0, 59529, 0, 0, 0,
+        57444, 0, 0, 0, 57448, 0,
+    },
+    {
+        0, 57446, 0, 0, 0, 0, 0, 0, 0, 57442,
+        0, 57443, 0, 0, 0, 57447, 0, 57445, 0, 0,
+        0, 38253, 0, 0, 57453, 0, 57450, 57449, 0, 57452,
+        37842, 57454, 0, 0, 0, 0, 0, 0, 37525, 37355,
+        0, 0, 0, 0, 37027, 0, 0, 0, 57455, 0,
+        57457, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57456, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40947, 0, 0, 0,
+        0, 57458, 0, 0, 0, 0, 0, 0, 37861, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 57459,
+        0, 0, 0, 0, 0, 0, 0, 35278, 0, 0,
+        0, 37780, 35396, 0, 0, 0, 0, 0, 0, 0,
+        35716, 0, 0, 0, 36572, 36304, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38982, 36998, 0,
+        0, 0, 35210, 0, 0, 0, 57461, 0, 0, 0,
+        0, 0, 0, 57460, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57464, 37465, 57467, 57462, 0, 0, 0, 57466,
+        0, 0, 0, 0, 57465, 37727, 35031, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        38899, 0, 0, 57469, 0, 0, 0, 35143, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57472, 0, 0,
+        0, 57470, 0, 57468, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 57463, 0, 0, 0, 0, 0, 0, 0, 38466,
+        0, 0, 0, 57474, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 57473,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35211, 0, 0, 0, 0, 57476, 38320, 0, 57475, 0,
+        0, 0, 0, 38579, 0, 0, 0, 0, 36805, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 37202, 0, 0, 0, 0, 0,
+        36804, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 38905, 0, 0, 57482, 0, 37111, 0,
+        0, 0, 0, 0, 0, 57478, 57483, 0, 0, 35212,
+        0, 0, 0, 0, 0, 0, 0, 0, 57481, 0,
+        38017, 57477, 57480, 36806, 0, 38095, 0, 0, 57484, 0,
+        36559, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 37112, 0, 0, 0, 0,
+        0, 0, 57487, 0, 0, 0, 57479, 0, 35910, 0,
+        0, 0, 0, 57485, 0, 0, 0, 0, 38767, 57488,
+        0, 0, 0, 60068, 0, 0, 0, 0, 0, 36718,
+        0, 0, 0, 0, 0, 0, 0, 0, 57489, 0,
+        0, 0, 57490, 0, 0, 0, 0, 37965, 0, 0,
+        0, 0, 0, 0, 0, 57492, 0, 0, 0, 0,
+        57493, 0, 0, 0, 0, 37970, 0, 0, 0, 0,
+        37781, 57495, 0, 0, 0, 0, 57497, 0, 38867, 0,
+        57494, 0, 57496, 35213, 0, 57491, 0, 0, 0, 0,
+        0, 0, 0, 39546, 57498, 0, 0, 0, 0, 37255,
+        36439, 57500, 0, 0, 0, 0, 57499, 36931, 39383, 0,
+        0, 0, 0, 0, 0, 57501, 0, 0, 0, 57503,
+        0, 57486, 57502, 0, 0, 57504,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 38042, 0, 0, 0,
+        0, 0, 0, 57505, 0, 0, 57506, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57507, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        57508, 0, 37596, 0, 57510, 57509, 0, 0, 57511, 0,
+        57512, 0, 0, 36573, 38275, 0, 0, 0, 38634, 57513,
+        57514, 37237, 36514, 57515, 57516, 0, 0, 0, 0, 0,
+        57517, 38352, 38085, 0, 0, 57518, 38006, 0, 0, 0,
+        0, 0, 37547, 0, 0, 0, 0, 0, 57519, 35301,
+        0, 35725, 0, 38596, 0, 38580, 0, 35250, 38995, 0,
+        0, 0, 0, 38513, 0, 38312, 0, 0, 0, 0,
+        0, 0, 0, 0, 37045, 0, 57520, 0, 0, 0,
+        0, 37825, 0, 0, 0, 36001, 57521, 0, 36306, 57523,
+        57522, 0, 0, 0, 0, 57524, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 57525, 0, 0, 0,
+        57526, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35677, 0, 57527, 0, 0, 0, 0, 57528, 0, 0,
+        0, 0, 36002, 0, 0, 38086, 0, 0, 57530, 0,
+        0, 0, 36851, 0, 0, 57529, 0, 0, 0, 0,
+        0, 0, 0, 0, 35766, 57531, 57533, 0, 57532, 0,
+        0, 0, 0, 0, 0, 0, 57534, 0, 36047, 0,
+        57535, 0, 0, 0, 0, 35815, 0, 37215, 0, 36253,
+        0, 0, 0, 0, 57537, 57538, 57536, 0, 0, 0,
+        0, 0, 0, 36587, 0, 0, 37830, 35767, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57540, 37451, 57539,
+        0, 0, 38996, 38018, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        57543, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57545, 57542, 0, 0, 0, 38610, 57544, 57546,
+        0, 38850, 0, 0, 0, 0, 0, 57550, 0, 0,
+        0, 57549, 37526, 37964, 0, 0, 36003, 57548, 0, 0,
+        0, 0, 57547, 0, 38736, 38737, 0, 0, 0, 0,
+        0, 0, 57551, 35214, 0, 0, 0, 0, 36246, 36482,
+        0, 0, 0, 0, 0, 0, 0, 0, 57552, 57553,
+        0, 0, 0, 0, 0, 0, 0, 57555, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 36706,
+        0, 0, 0, 0, 57557, 0, 57556, 0, 0, 0,
+        0, 0, 57558, 0, 35436, 0, 0, 57560, 0, 0,
+        57559, 0, 57562, 57561, 0, 0, 0, 0, 0, 0,
+        0, 0, 36026, 0, 0, 38822, 0, 35786, 0, 35236,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35816, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 35551,
+        0, 0, 0, 0, 0, 0, 0, 0, 38886, 57564,
+        0, 0, 0, 0, 0, 0, 0, 57566, 0, 0,
+        0, 0, 57567, 0, 35279, 0, 0, 0, 0, 0,
+        57563, 0, 36440, 0, 0, 37567, 57565, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57570, 0, 36588, 0, 0, 0, 0, 57568,
+        0, 0, 0, 0, 35933, 0, 0, 38087, 57569, 0,
+        0, 57596, 0, 0, 0, 0, 0, 0, 57575, 0,
+        0, 0, 0, 0, 36027, 0,
+    },
+    {
+        0, 0, 0, 35717, 0, 57572, 38813, 0, 0, 38830,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 37364, 0, 0, 57574, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        57576, 38868, 35797, 38138, 37993, 0, 0, 0, 57577, 0,
+        0, 0, 0, 57579, 0, 57582, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 57578, 0, 0, 0, 57581,
+        36072, 35180, 57583, 0, 37008, 57580, 38874, 0, 0, 57586,
+        60066, 0, 0, 0, 0, 57584, 57587, 0, 0, 0,
+        0, 57573, 57585, 0, 0, 36282, 0, 0, 57588, 0,
+        0, 0, 0, 0, 0, 0, 57589, 0, 0, 0,
+        0, 38814, 0, 0, 0, 0, 0, 0, 0, 57590,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57591, 0,
+        0, 0, 57571, 0, 0, 0, 0, 57592, 0, 0,
+        0, 0, 0, 0, 0, 0, 35522, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 36515,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57593, 0, 0, 0, 0, 57594, 0, 0,
+        0, 0, 57595, 0, 0, 0, 0, 0, 0, 0,
+        35162, 0, 0, 0, 57664, 0, 38234, 57665, 0, 0,
+        35490, 57666, 0, 57667, 0, 0, 0, 0, 57668, 0,
+        57670, 57671, 57669, 0, 0, 0, 38258, 57673, 57672, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 57675, 57674, 57676, 0, 0, 0, 0,
+        0, 0, 57677, 57679, 57678, 0, 0, 36249, 0, 57681,
+        0, 57680, 0, 0, 35523, 0, 36978, 0, 37723, 0,
+        57682, 37046, 0, 0, 0, 36441, 0, 35225, 57683, 0,
+        38768, 0, 0, 38369, 57684, 0, 0, 0, 37731, 38738,
+        36194, 36956, 0, 0, 0, 37482, 39346, 0, 37548, 35302,
+        57685, 0, 0, 0, 0, 0, 0, 0, 57686, 0,
+        57691, 0, 0, 57689, 57688, 40384, 35397, 57687, 0, 35032,
+        0, 38056, 0, 0, 38088, 0, 0, 0, 0, 38831,
+        57692, 57690, 37499, 37028, 0, 0, 38057, 0, 38220, 0,
+        57694, 38826, 35948, 57695, 0, 57693, 38100, 57696, 0, 57697,
+        0, 0, 35033, 0, 0, 36852, 57702, 0, 57699, 37867,
+        57698, 0, 0, 0, 0, 0, 0, 35653, 0, 0,
+        57705, 0, 0, 0, 57700, 57701, 0, 57704, 57703, 38212,
+        0, 0, 37217, 37216, 0, 35678, 0, 0, 57706, 0,
+        0, 0, 0, 0, 57707, 0, 0, 57708, 0, 0,
+        0, 0, 0, 57710, 0, 57709, 0, 0, 0, 0,
+        0, 35189, 0, 0, 0, 0, 0, 57718, 38118, 57712,
+        0, 57714, 0, 0, 57716, 36957, 0, 0, 57717, 57715,
+        36542, 0, 0, 0, 57711, 57713, 0, 38241, 0, 36807,
+        0, 0, 57720, 0, 0, 57719, 0, 0, 0, 0,
+        57721, 0, 36516, 36269, 0, 0, 37783, 57722, 0, 37577,
+        0, 0, 57724, 0, 0, 0, 38815, 57723, 0, 0,
+        0, 0, 0, 37257, 0, 0, 0, 0, 0, 0,
+        57730, 0, 57732, 57733, 37491, 0, 0, 0, 0, 0,
+        57731, 0, 57728, 0, 57725, 57726,
+    },
+    {
+        0, 57729, 0, 0, 0, 0, 0, 0, 0, 57736,
+        0, 57734, 0, 57735, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 57737, 57739, 57740, 57741, 0, 57742, 0, 0, 57738,
+        0, 0, 0, 0, 0, 0, 0, 0, 57744, 0,
+        0, 0, 57743, 0, 0, 0, 0, 0, 0, 57745,
+        0, 0, 0, 0, 0, 0, 38851, 0, 0, 0,
+        57748, 57746, 57747, 0, 0, 0, 35552, 0, 0, 0,
+        0, 0, 38652, 0, 0, 0, 38344, 0, 57750, 0,
+        0, 0, 57749, 0, 0, 0, 0, 57751, 57752, 0,
+        0, 0, 0, 57756, 57753, 57754, 57755, 0, 57757, 0,
+        0, 0, 57758, 0, 57759, 0, 0, 0, 57760, 0,
+        57761, 0, 38061, 37743, 57762, 38034, 38227, 0, 57763, 0,
+        0, 57764, 37705, 0, 35398, 36195, 57765, 0, 0, 57766,
+        0, 0, 57767, 0, 36424, 0, 0, 57769, 0, 0,
+        57768, 0, 0, 57770, 57771, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 38119, 0, 57772, 0, 0, 0,
+        57773, 0, 0, 60041, 57774, 57775, 57776, 0, 0, 0,
+        0, 36429, 0, 0, 57777, 38005, 0, 0, 38526, 0,
+        35181, 0, 35190, 0, 0, 57778, 0, 0, 0, 0,
+        57780, 0, 0, 0, 57779, 37776, 0, 0, 0, 37047,
+        40792, 0, 57781, 38591, 0, 57782, 0, 35524, 38101, 57783,
+        0, 57784, 0, 0, 57785, 0, 0, 0, 38618, 0,
+        0, 0, 38611, 0, 37564, 0, 0, 0, 37258, 0,
+        0, 57787, 0, 0, 36738, 0,
+    },
+    {
+        0, 36808, 0, 0, 57790, 0, 0, 57789, 57788, 38139,
+        0, 35525, 36007, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57796, 0, 0,
+        57793, 36958, 38576, 0, 0, 0, 57792, 57794, 57795, 0,
+        0, 57791, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 57797, 57798, 0, 37549, 0,
+        35553, 0, 0, 0, 37509, 0, 0, 0, 0, 0,
+        0, 57799, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        57800, 57803, 0, 0, 0, 0, 0, 36999, 0, 37826,
+        0, 57804, 38514, 0, 57801, 0, 0, 57802, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 57807, 0, 0, 0, 0, 57806, 57805, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 57809,
+        0, 0, 57808, 0, 0, 57810, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57812, 0,
+        57811, 0, 0, 0, 0, 38347, 0, 0, 0, 0,
+        0, 0, 36725, 38852, 0, 0, 57813, 0, 0, 37813,
+        0, 0, 57814, 0, 0, 57815, 0, 57819, 57817, 57818,
+        0, 57816, 0, 0, 0, 0, 0, 0, 0, 57820,
+        0, 0, 0, 0, 0, 57821, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 57822, 0, 0, 57823, 38581,
+        57824, 0, 0, 0, 0, 0, 38638, 57825, 0, 37485,
+        0, 38026, 0, 35817, 0, 0, 0, 37466, 57826, 35768,
+        0, 0, 0, 37070, 0, 0, 0, 0, 0, 0,
+        0, 0, 57827, 0, 0, 0,
+    },
+    {
+        0, 0, 36283, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57828, 0, 0, 0, 0, 0, 57829, 0,
+        36004, 36307, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 57831, 0, 0, 0, 0, 37749, 36308, 35693,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        38467, 0, 37994, 0, 0, 0, 0, 0, 37750, 0,
+        0, 0, 0, 36219, 0, 0, 0, 0, 0, 57833,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 36809, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38832, 36196, 0,
+        0, 36005, 0, 0, 38049, 0, 57835, 0, 0, 0,
+        0, 0, 0, 0, 57837, 0, 0, 0, 0, 36073,
+        0, 0, 0, 0, 57836, 37620, 0, 0, 0, 0,
+        57839, 35414, 57834, 0, 0, 38120, 0, 35151, 0, 36330,
+        0, 39025, 0, 0, 57838, 0, 0, 0, 0, 0,
+        0, 0, 0, 57840, 0, 0, 0, 38345, 0, 37079,
+        57842, 0, 0, 0, 0, 57843, 0, 0, 0, 0,
+        0, 57841, 0, 0, 0, 0, 35437, 0, 57849, 0,
+        57848, 0, 0, 36517, 0, 0, 0, 57850, 57845, 0,
+        0, 0, 57851, 57846, 0, 0, 0, 0, 38102, 57844,
+        0, 0, 57847, 0, 0, 0, 0, 0, 57921, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 57920, 38529, 0, 0, 0, 57852, 0, 0, 35049,
+        0, 0, 0, 0, 57923, 0, 0, 0, 0, 0,
+        0, 0, 0, 57922, 0, 0,
+    },
+    {
+        0, 36810, 0, 0, 0, 0, 0, 57924, 0, 0,
+        0, 0, 0, 0, 37218, 0, 0, 57926, 57925, 0,
+        0, 0, 0, 0, 0, 57927, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57830, 0,
+        0, 0, 57832, 57929, 57928, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 36518, 0,
+        38887, 0, 36560, 0, 57930, 35926, 0, 0, 0, 0,
+        0, 35679, 35654, 36483, 0, 0, 0, 0, 0, 0,
+        38739, 0, 0, 57936, 0, 57935, 37219, 57932, 0, 0,
+        57934, 0, 0, 36714, 36959, 57933, 57931, 0, 37961, 0,
+        0, 36811, 0, 0, 38235, 0, 0, 0, 0, 36309,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 37784,
+        0, 0, 57937, 0, 0, 0, 0, 57938, 57960, 35798,
+        0, 0, 39004, 37204, 0, 0, 0, 0, 57939, 0,
+        0, 35280, 37621, 38303, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57940, 0, 0,
+        0, 0, 0, 0, 0, 0, 35738, 57941, 0, 0,
+        57943, 0, 0, 0, 57944, 0, 37960, 0, 0, 57945,
+        0, 0, 0, 0, 0, 57946, 57947, 0, 0, 35799,
+        35281, 37827, 36679, 36484, 0, 0, 0, 0, 0, 0,
+        0, 57948, 0, 36680, 0, 0, 0, 0, 0, 35272,
+        38242, 0, 0, 57949, 0, 0, 38121, 0, 0, 0,
+        0, 0, 0, 37220, 0, 57952, 0, 57953, 38025, 0,
+        36960, 57950, 0, 37505, 0, 0, 57951, 0, 0, 0,
+        36812, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 35034, 0, 0, 0, 0,
+    },
+    {
+        35656, 0, 0, 0, 0, 0, 0, 0, 57954, 0,
+        0, 37622, 0, 57955, 37061, 0, 0, 0, 0, 0,
+        38571, 0, 0, 38210, 57956, 57957, 37492, 0, 38853, 0,
+        0, 57959, 57958, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 36589, 0, 0, 57961,
+        35054, 0, 0, 0, 0, 57964, 0, 0, 0, 57962,
+        35282, 35949, 57963, 36197, 36242, 0, 38372, 57965, 0, 0,
+        38515, 0, 0, 57967, 0, 0, 0, 37071, 35182, 35256,
+        34986, 0, 0, 0, 0, 0, 0, 57966, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57968, 57969, 36853,
+        0, 0, 0, 0, 0, 57970, 0, 35438, 0, 0,
+        0, 0, 57972, 0, 0, 0, 35978, 0, 35718, 0,
+        0, 57973, 35827, 0, 0, 57974, 0, 37114, 0, 37835,
+        0, 37086, 36339, 0, 0, 0, 57975, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 37506, 37259, 0, 57977,
+        57979, 57976, 57978, 0, 0, 0, 0, 0, 0, 35905,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 57980,
+        35909, 0, 0, 0, 35719, 38769, 57982, 0, 0, 0,
+        0, 0, 57984, 0, 0, 0, 35149, 0, 0, 0,
+        0, 57987, 0, 0, 0, 35478, 57986, 57985, 0, 57989,
+        57981, 0, 57990, 38823, 0, 57991, 0, 57992, 0, 0,
+        39666, 57994, 0, 57993, 0, 0, 0, 57995, 57996, 0,
+        38835, 57997, 0, 59629, 36813, 57998, 57999, 36726, 0, 37814,
+        58000, 0, 0, 0, 37447, 0, 0, 58001, 0, 37467,
+        58002, 0, 0, 0, 0, 0, 35747, 0, 39262, 37500,
+        36529, 0, 0, 0, 0, 35526,
+    },
+    {
+        0, 0, 58003, 0, 58016, 0, 58006, 0, 35720, 0,
+        58005, 58018, 0, 0, 0, 58004, 0, 36814, 0, 0,
+        0, 0, 0, 0, 58008, 58009, 0, 37706, 0, 0,
+        58010, 0, 35453, 0, 0, 0, 0, 36985, 38276, 0,
+        58012, 0, 0, 0, 37350, 0, 0, 0, 0, 0,
+        0, 58007, 0, 58011, 58013, 0, 0, 36345, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58020,
+        38221, 0, 38052, 37785, 0, 35800, 58019, 58017, 0, 38067,
+        58014, 37501, 37787, 0, 37786, 0, 36340, 0, 0, 0,
+        0, 0, 0, 58038, 0, 0, 0, 0, 0, 0,
+        0, 58022, 0, 58024, 0, 0, 0, 0, 58027, 0,
+        58028, 0, 58025, 58026, 0, 0, 58023, 58021, 0, 0,
+        0, 0, 58015, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 38349, 35283, 0, 0, 0, 58035,
+        0, 58032, 0, 58037, 0, 0, 58036, 0, 38035, 38565,
+        0, 36442, 58030, 58039, 58034, 0, 58033, 58029, 0, 58031,
+        0, 35527, 0, 0, 0, 0, 0, 0, 0, 0,
+        37468, 0, 0, 37115, 0, 0, 0, 38048, 0, 0,
+        58044, 0, 0, 0, 38050, 0, 0, 0, 0, 0,
+        0, 0, 37087, 58041, 0, 0, 38093, 0, 58045, 38353,
+        0, 37498, 0, 58040, 58042, 0, 0, 58043, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 58046, 0, 0, 36546, 0, 0, 0, 37828, 58051,
+        58050, 0, 0, 58047, 0, 0, 0, 38997, 0, 0,
+        0, 0, 0, 58056, 0, 0, 58060, 58057, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        58053, 0, 0, 0, 0, 0, 0, 58054, 0, 0,
+        0, 0, 0, 58059, 0, 0, 0, 58048, 39379, 58055,
+        58049, 0, 0, 58058, 0, 0, 0, 0, 0, 0,
+        0, 58064, 0, 35528, 0, 58061, 0, 0, 0, 58062,
+        0, 0, 58063, 58066, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 58065, 38132, 0, 0, 0,
+        0, 58067, 38906, 38379, 58072, 0, 0, 58069, 0, 0,
+        0, 0, 0, 0, 0, 0, 58068, 37072, 0, 58071,
+        58073, 0, 0, 0, 58070, 0, 58077, 0, 58074, 0,
+        0, 0, 0, 0, 0, 58075, 58052, 0, 0, 0,
+        58076, 58078, 0, 0, 0, 0, 0, 0, 58079, 0,
+        0, 0, 0, 0, 0, 38340, 0, 58080, 0, 0,
+        0, 0, 0, 0, 0, 0, 38624, 0, 0, 35788,
+        35912, 58081, 0, 0, 0, 0, 0, 38322, 0, 37000,
+        0, 38574, 0, 0, 58082, 0, 38833, 0, 0, 38036,
+        0, 37221, 37971, 0, 0, 36716, 0, 0, 0, 35006,
+        0, 58087, 58085, 0, 58083, 35487, 0, 36815, 58088, 0,
+        0, 58086, 0, 58084, 58092, 0, 0, 58091, 58090, 58089,
+        0, 0, 0, 0, 0, 58093, 0, 0, 0, 58094,
+        37048, 0, 58095, 0, 58097, 0, 0, 58096, 0, 0,
+        0, 0, 36048, 0, 0, 0, 37207, 0, 0, 0,
+        58099, 0, 0, 0, 37788, 0, 58098, 0, 0, 0,
+        58100, 0, 38323, 37260, 36198, 0, 58101, 0, 0, 0,
+        0, 38854, 0, 0, 0, 0, 0, 0, 0, 58103,
+        0, 0, 58104, 0, 58105, 0, 58106, 0, 36485, 0,
+        58107, 35950, 0, 0, 35722, 0,
+    },
+    {
+        35657, 0, 58176, 0, 38641, 36199, 58108, 0, 0, 0,
+        58179, 38628, 0, 37979, 0, 0, 38226, 0, 0, 0,
+        36739, 58178, 0, 36561, 36200, 36486, 35721, 38324, 58177, 0,
+        0, 0, 37222, 38497, 36341, 0, 0, 0, 0, 0,
+        0, 0, 0, 36487, 37595, 0, 58182, 38877, 36311, 0,
+        58183, 36961, 0, 58185, 0, 0, 0, 36816, 36270, 0,
+        0, 0, 0, 58184, 0, 0, 36681, 36028, 37223, 58180,
+        58186, 0, 0, 0, 0, 58181, 35951, 0, 58189, 58193,
+        35979, 0, 0, 0, 0, 0, 58188, 0, 0, 0,
+        0, 58197, 0, 0, 36201, 0, 0, 38797, 35002, 58194,
+        0, 0, 35723, 0, 58191, 0, 0, 0, 0, 0,
+        58192, 0, 0, 37789, 58190, 58187, 0, 35399, 37090, 0,
+        0, 36006, 0, 0, 0, 58199, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 58196, 0, 0,
+        0, 0, 0, 58198, 0, 0, 0, 58195, 0, 0,
+        0, 0, 0, 35952, 37297, 58200, 37262, 0, 0, 58213,
+        0, 0, 58209, 58203, 0, 0, 0, 0, 0, 0,
+        0, 58207, 36600, 35035, 58202, 58210, 58214, 36202, 38612, 0,
+        37588, 58204, 0, 0, 58212, 0, 58201, 37469, 0, 58206,
+        35003, 38600, 0, 0, 0, 0, 0, 0, 0, 58205,
+        0, 0, 35801, 38122, 0, 0, 0, 37261, 0, 38862,
+        36751, 0, 0, 58254, 0, 0, 58215, 0, 37116, 0,
+        58211, 58216, 58218, 0, 37623, 58221, 0, 0, 58217, 0,
+        0, 0, 38354, 35529, 0, 0, 38601, 0, 0, 35036,
+        0, 0, 58220, 0, 38907, 0, 0, 0, 0, 0,
+        0, 58219, 0, 0, 0, 0,
+    },
+    {
+        0, 35215, 0, 0, 37866, 58222, 0, 0, 0, 58229,
+        58223, 58230, 0, 0, 0, 0, 0, 0, 58226, 0,
+        0, 0, 0, 0, 0, 0, 0, 38043, 0, 0,
+        36552, 58228, 0, 58225, 58231, 58224, 0, 0, 36707, 0,
+        0, 0, 0, 38468, 0, 0, 36715, 0, 0, 58227,
+        58240, 0, 0, 58235, 0, 58238, 0, 58236, 58241, 58234,
+        0, 58208, 37073, 0, 0, 38089, 0, 58237, 0, 0,
+        58232, 0, 0, 0, 37184, 35953, 0, 36682, 0, 0,
+        0, 0, 0, 0, 36932, 37205, 58244, 0, 0, 58246,
+        58247, 0, 0, 58243, 58245, 0, 0, 0, 0, 0,
+        0, 0, 58233, 58242, 0, 58250, 58249, 0, 0, 38554,
+        0, 0, 35914, 0, 0, 0, 0, 0, 0, 0,
+        0, 58248, 0, 58252, 58251, 58255, 0, 58257, 0, 0,
+        36443, 58253, 0, 0, 0, 0, 58258, 58259, 0, 0,
+        58260, 0, 58266, 37722, 58262, 0, 58261, 58263, 58264, 0,
+        58265, 0, 0, 0, 0, 58267, 58268, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 35530, 0, 58269, 0, 58270, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58271,
+        0, 0, 0, 0, 0, 0, 58272, 58273, 58274, 0,
+        58275, 58276, 0, 0, 58278, 58277, 0, 0, 58279, 0,
+        0, 0, 0, 0, 0, 58280, 58281, 0, 0, 0,
+        0, 0, 0, 58284, 58282, 58283, 36319, 35954, 0, 0,
+        37493, 0, 38065, 0, 36752, 0, 0, 37996, 0, 38123,
+        58285, 40171, 0, 0, 0, 0, 0, 0, 0, 0,
+        58286, 58288, 0, 38789, 58287, 58290, 58289, 0, 38770, 0,
+        58291, 0, 38140, 0, 0, 0, 0, 0, 58292, 0,
+        0, 0, 0, 0, 58295, 0, 0, 58294, 58293, 0,
+        0, 0, 0, 58296, 35921, 0, 0, 0, 37185, 35680,
+        0, 0, 0, 0, 58300, 58297, 0, 0, 58298, 0,
+        0, 0, 58301, 0, 58302, 58299, 0, 0, 0, 35144,
+        0, 0, 0, 35237, 0, 0, 0, 58304, 58305, 0,
+        0, 0, 58306, 0, 38786, 0, 0, 0, 0, 0,
+        36683, 0, 58308, 58307, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 37001, 58309, 0, 0, 0, 0,
+        58310, 0, 0, 58311, 0, 35555, 0, 0, 0, 0,
+        35531, 0, 0, 58312, 0, 0, 0, 0, 0, 58313,
+        0, 38524, 38787, 0, 0, 0,
+    },
+    {
+        38771, 38998, 0, 36204, 58316, 36562, 58315, 0, 0, 0,
+        0, 58317, 36519, 0, 0, 0, 37327, 0, 58318, 0,
+        0, 36203, 0, 38613, 58319, 58320, 0, 0, 58321, 0,
+        0, 0, 0, 58322, 0, 0, 0, 0, 0, 0,
+        58323, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 36520, 0, 0, 38635, 0, 0, 0, 0, 58325,
+        0, 37470, 0, 58324, 0, 0, 0, 0, 0, 0,
+        58327, 0, 0, 0, 58326, 0, 0, 0, 0, 0,
+        0, 0, 58328, 0, 0, 0, 37049, 0, 58329, 0,
+        58330, 0, 0, 0, 38327, 58331, 0, 37263, 58332, 0,
+        0, 0, 0, 0, 58333, 0, 0, 0, 0, 0,
+        0, 38908, 58336, 0, 58335, 58334, 37550, 0, 58337, 36933,
+        0, 58338, 0, 0, 0, 58339, 38999, 58340, 0, 0,
+        0, 0, 58341, 58343, 58342, 38051, 0, 37879, 0, 39005,
+        38055, 0, 0, 0, 0, 0, 0, 58345, 0, 0,
+        36817, 0, 38217, 0, 58346, 58344, 0, 35532, 0, 0,
+        0, 36050, 36488, 0, 0, 38124, 0, 0, 0, 36008,
+        38498, 0, 58349, 58347, 0, 36205, 0, 36206, 35047, 0,
+        36326, 0, 0, 0, 0, 0, 38008, 0, 0, 0,
+        0, 0, 0, 0, 0, 35037, 58354, 0, 37471, 0,
+        0, 0, 0, 0, 38007, 0, 37337, 0, 0, 0,
+        0, 0, 0, 0, 58356, 0, 0, 58352, 58355, 58350,
+        0, 58353, 38469, 0, 0, 36051, 0, 0, 35067, 58351,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58358,
+        0, 58359, 0, 0, 37815, 0, 0, 0, 35769, 0,
+        0, 0, 58437, 37980, 0, 0,
+    },
+    {
+        0, 0, 36489, 0, 0, 35770, 37062, 39013, 38572, 58357,
+        37074, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 35698, 58360, 0, 0,
+        0, 0, 0, 0, 0, 58362, 0, 0, 0, 0,
+        0, 58361, 0, 0, 0, 0, 0, 58363, 0, 37445,
+        0, 37981, 0, 0, 0, 0, 0, 37551, 0, 0,
+        0, 0, 58434, 0, 0, 0, 0, 0, 0, 0,
+        58433, 0, 0, 0, 0, 58364, 0, 0, 36980, 0,
+        38277, 58436, 0, 58435, 36207, 39026, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 58452, 0, 0, 0, 0,
+        0, 58440, 58441, 0, 0, 0, 0, 36590, 0, 0,
+        58439, 0, 36248, 58438, 0, 0, 58442, 0, 0, 0,
+        37552, 38304, 37186, 0, 0, 0, 0, 37338, 58446, 0,
+        58447, 58443, 0, 0, 0, 0, 58444, 0, 58445, 0,
+        0, 0, 0, 36208, 0, 0, 0, 58453, 0, 58449,
+        0, 0, 0, 0, 38278, 0, 38540, 38215, 0, 0,
+        58448, 0, 0, 58451, 58450, 0, 0, 0, 38499, 58454,
+        0, 0, 0, 0, 0, 0, 58455, 0, 0, 37206,
+        0, 58456, 0, 0, 58458, 0, 58462, 0, 0, 58459,
+        58457, 37982, 58460, 0, 58461, 0, 0, 0, 35248, 0,
+        58468, 58463, 0, 0, 0, 58464, 0, 0, 0, 58465,
+        0, 37279, 0, 0, 0, 0, 58467, 58466, 58469, 0,
+        0, 0, 0, 58470, 58471, 0, 0, 36962, 0, 35303,
+        0, 58472, 38869, 0, 36521, 0, 0, 36684, 0, 0,
+        0, 0, 0, 36490, 37494, 0, 0, 0, 0, 0,
+        58473, 58474, 35152, 0, 58475, 0,
+    },
+    {
+        0, 58476, 58477, 0, 0, 58478, 0, 58479, 35771, 40360,
+        58480, 0, 37091, 58481, 36553, 0, 58482, 0, 39086, 0,
+        0, 0, 58483, 38364, 35546, 0, 0, 37187, 36727, 0,
+        38289, 36685, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 58484, 36209, 58485, 38090, 0, 58500, 0, 0, 0,
+        0, 58487, 0, 37319, 38037, 36029, 58486, 37188, 0, 0,
+        0, 0, 0, 0, 58488, 0, 0, 0, 0, 0,
+        0, 37624, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 58490, 58489,
+        58492, 0, 0, 58491, 0, 58493, 0, 0, 58496, 0,
+        58494, 0, 35533, 0, 58497, 0, 58498, 58499, 0, 0,
+        36271, 38855, 0, 58501, 36934, 0, 0, 0, 35216, 58502,
+        58503, 0, 0, 0, 0, 0, 58504, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 35056,
+        0, 58505, 0, 0, 0, 0, 58506, 0, 0, 0,
+        0, 0, 0, 38279, 0, 0, 0, 36549, 0, 58508,
+        0, 0, 0, 0, 0, 35400, 34992, 0, 0, 0,
+        0, 58507, 58510, 37997, 0, 36963, 0, 35284, 0, 38470,
+        0, 0, 0, 0, 35964, 35802, 0, 58509, 0, 35304,
+        0, 0, 0, 0, 0, 0, 0, 35489, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 35217,
+        58514, 38888, 37339, 0, 0, 38243, 0, 58526, 0, 35285,
+        58524, 0, 58522, 58513, 0, 58511, 0, 58512, 0, 36577,
+        35818, 37527, 0, 0, 0, 37839, 0, 0, 0, 0,
+        0, 35184, 0, 58516, 58515, 0, 0, 0, 0, 58521,
+        58517, 58520, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 38606, 58519, 35286, 35485, 58523, 0, 0, 58525,
+        0, 0, 0, 0, 35955, 0, 0, 0, 0, 0,
+        0, 0, 58529, 58538, 58539, 0, 0, 0, 34985, 0,
+        0, 0, 0, 0, 0, 58546, 0, 0, 0, 0,
+        35055, 0, 0, 58537, 0, 0, 0, 58536, 0, 58531,
+        58530, 0, 58528, 58527, 37507, 0, 37369, 58533, 0, 0,
+        0, 0, 0, 0, 58532, 0, 0, 0, 0, 58535,
+        0, 0, 0, 37264, 35956, 0, 0, 0, 0, 35168,
+        58534, 0, 36210, 0, 0, 0, 0, 0, 37265, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 58552, 0, 58553, 0, 35287,
+        0, 0, 0, 35244, 58550, 0, 0, 0, 0, 0,
+        0, 0, 0, 58540, 0, 58548, 0, 58555, 58549, 0,
+        0, 0, 58547, 0, 0, 0, 0, 58518, 0, 0,
+        58545, 0, 0, 0, 58541, 0, 0, 0, 35534, 58543,
+        58554, 0, 58544, 0, 0, 0, 0, 0, 58556, 0,
+        58542, 38044, 0, 0, 0, 0, 0, 38793, 0, 0,
+        0, 58551, 0, 0, 0, 0, 0, 0, 0, 58573,
+        0, 0, 0, 58565, 0, 0, 0, 37019, 0, 0,
+        0, 0, 35685, 0, 35803, 0, 58560, 0, 0, 0,
+        0, 35289, 0, 0, 36818, 0, 58563, 0, 0, 0,
+        36312, 0, 0, 37744, 58568, 0, 0, 0, 0, 0,
+        0, 0, 0, 38380, 0, 58559, 0, 0, 0, 35288,
+        36052, 38216, 58569, 0, 58557, 0, 0, 58566, 0, 0,
+        0, 58576, 0, 58561, 0, 0,
+    },
+    {
+        0, 0, 0, 58562, 37816, 0, 0, 58567, 0, 0,
+        0, 58564, 38471, 58570, 35038, 0, 0, 0, 0, 58558,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 58572, 0, 58571, 0, 0, 0, 0, 0,
+        0, 38027, 58578, 0, 58589, 0, 0, 0, 0, 35486,
+        0, 0, 0, 58592, 0, 0, 58574, 0, 0, 0,
+        58579, 38798, 0, 0, 0, 0, 0, 0, 0, 0,
+        58588, 0, 0, 38772, 0, 0, 0, 0, 38824, 0,
+        0, 0, 0, 0, 0, 0, 0, 37528, 0, 0,
+        0, 35467, 0, 0, 0, 0, 0, 38290, 58594, 37791,
+        0, 0, 34991, 0, 0, 58587, 0, 58583, 37266, 58577,
+        58585, 58590, 0, 37963, 0, 0, 0, 34984, 0, 58582,
+        0, 58591, 38296, 0, 0, 0, 0, 0, 0, 0,
+        58586, 0, 58581, 0, 0, 0, 0, 0, 0, 36819,
+        0, 0, 0, 0, 36686, 0, 0, 0, 36522, 0,
+        0, 0, 0, 38614, 0, 0, 38246, 0, 0, 58597,
+        0, 58606, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 58584, 0, 0, 0, 0, 35479, 0,
+        0, 0, 0, 0, 36854, 58595, 0, 58600, 37267, 0,
+        0, 58596, 0, 58603, 0, 0, 37502, 0, 58604, 0,
+        0, 38773, 58593, 35415, 0, 58599, 0, 0, 58602, 38570,
+        0, 0, 0, 0, 58605, 0, 0, 58598, 58601, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 38472, 0, 38976, 0,
+        0, 0, 0, 0, 58609, 0, 0, 0, 0, 0,
+        0, 0, 58616, 0, 0, 58608,
+    },
+    {
+        36545, 0, 0, 0, 0, 0, 58575, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38348, 0, 38560,
+        58615, 58614, 0, 58610, 58611, 0, 35157, 0, 0, 0,
+        0, 58613, 0, 58607, 0, 0, 0, 0, 37587, 0,
+        0, 0, 0, 0, 58612, 35068, 0, 0, 0, 0,
+        0, 0, 0, 37280, 0, 0, 0, 0, 0, 0,
+        0, 38337, 0, 0, 58617, 58688, 0, 38103, 0, 0,
+        0, 0, 58620, 36820, 36551, 58690, 0, 0, 35772, 0,
+        0, 0, 0, 0, 0, 58691, 0, 38297, 58619, 0,
+        58580, 0, 0, 0, 0, 0, 0, 0, 0, 58618,
+        0, 0, 0, 0, 39022, 37792, 38291, 0, 0, 58698,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58704,
+        0, 0, 0, 0, 0, 0, 58705, 0, 58692, 0,
+        0, 0, 38038, 0, 0, 58702, 58694, 0, 58696, 0,
+        0, 0, 0, 0, 58706, 58695, 0, 0, 58699, 0,
+        0, 35218, 0, 37859, 0, 58700, 58703, 0, 0, 0,
+        0, 0, 0, 0, 58693, 0, 37189, 0, 58697, 36422,
+        36964, 35919, 38642, 0, 38647, 36754, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 58710, 58708, 0, 0, 0,
+        0, 0, 0, 39021, 0, 0, 0, 0, 0, 0,
+        0, 58707, 0, 0, 0, 38805, 0, 58709, 58711, 0,
+        0, 0, 0, 58712, 0, 0, 0, 0, 0, 0,
+        58715, 58713, 0, 0, 0, 0, 0, 0, 37793, 58714,
+        0, 0, 0, 38091, 58701, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 36755, 0, 58716,
+        58721, 37268, 0, 0, 58720, 0,
+    },
+    {
+        0, 0, 58689, 0, 0, 0, 58722, 37224, 0, 0,
+        58717, 58719, 0, 0, 0, 0, 0, 0, 0, 58718,
+        0, 0, 40784, 40769, 0, 0, 58724, 0, 0, 0,
+        0, 0, 0, 0, 58723, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 38806, 0, 57786, 58725, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 58726, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 58727, 36053, 0,
+        35699, 0, 0, 0, 58729, 39292, 0, 0, 0, 0,
+        35733, 0, 38840, 0, 35825, 58730, 0, 0, 0, 0,
+        0, 0, 0, 58731, 0, 0, 0, 37518, 0, 0,
+        0, 0, 0, 58732, 0, 0, 0, 0, 0, 0,
+        0, 37880, 0, 35000, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 35297, 58737,
+        58738, 0, 0, 0, 0, 0, 0, 58733, 0, 36444,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 58734, 37985, 0, 0, 0, 0, 58735,
+        58736, 58746, 0, 0, 0, 58740, 58743, 0, 0, 0,
+        0, 0, 58739, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 58741, 0, 58742, 36566,
+        0, 58744, 0, 37472, 0, 35957, 35425, 0, 0, 0,
+        0, 0, 58747, 0, 0, 0, 0, 35422, 0, 58753,
+        0, 0, 58748, 58752, 0, 0, 0, 0, 38072, 0,
+        0, 0, 0, 58749, 0, 0, 58750, 38247, 38104, 58754,
+        0, 0, 0, 0, 0, 0, 0, 0, 37371, 58764,
+        0, 58760, 0, 0, 35305, 0,
+    },
+    {
+        58758, 0, 38473, 58759, 0, 0, 58756, 0, 58757, 58762,
+        58765, 0, 0, 58763, 0, 0, 0, 58761, 58755, 0,
+        0, 0, 0, 0, 37495, 0, 58772, 0, 38568, 0,
+        0, 0, 0, 0, 0, 0, 0, 58770, 0, 0,
+        0, 58771, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 58766, 0, 0, 58768, 0, 0, 0, 58769,
+        0, 0, 0, 58767, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 37092, 0, 39000, 58776, 0, 58777, 0,
+        0, 0, 0, 58783, 0, 36937, 0, 58779, 0, 58782,
+        0, 0, 0, 0, 0, 58774, 58773, 0, 0, 58784,
+        0, 0, 35290, 0, 58780, 0, 58785, 0, 0, 0,
+        58781, 0, 0, 0, 0, 0, 58778, 0, 37553, 0,
+        58775, 0, 0, 0, 0, 0, 0, 38024, 0, 0,
+        58789, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 38746, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58788,
+        0, 0, 58787, 0, 0, 0, 0, 0, 0, 0,
+        0, 58796, 0, 0, 0, 58790, 0, 0, 0, 58798,
+        0, 0, 0, 0, 0, 0, 38790, 58801, 0, 58792,
+        0, 0, 58793, 0, 0, 0, 58797, 0, 58800, 58799,
+        0, 0, 0, 58791, 0, 0, 0, 0, 58794, 0,
+        58811, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 58804, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58802,
+        0, 0, 58803, 0, 0, 0, 58808, 58809, 0, 35401,
+        0, 35681, 0, 0, 58807, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 58786, 0, 0, 0, 0,
+        0, 0, 0, 58806, 58810, 58805, 0, 58812, 0, 0,
+        0, 58814, 58813, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 58816, 58815, 58745, 0, 0, 0, 58820,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58817,
+        0, 0, 0, 0, 58818, 0, 0, 58819, 0, 58821,
+        0, 0, 0, 0, 35980, 0, 58823, 0, 58822, 0,
+        36687, 0, 0, 0, 0, 0, 36211, 40869, 0, 0,
+        0, 0, 58824, 36720, 0, 0, 0, 35416, 0, 58825,
+        0, 35185, 0, 36821, 58826, 0, 0, 36212, 58827, 35039,
+        0, 0, 0, 0, 38236, 0, 0, 58828, 0, 0,
+        0, 0, 37002, 0, 58835, 0, 0, 58832, 0, 37519,
+        0, 0, 0, 0, 0, 58833, 58830, 35804, 0, 58829,
+        58836, 0, 0, 0, 0, 0, 35925, 0, 0, 37340,
+        0, 58842, 0, 0, 0, 0, 58838, 0, 0, 0,
+        37299, 58837, 0, 58840, 0, 0, 0, 0, 58831, 0,
+        0, 0, 58841, 0, 58843, 0, 0, 0, 0, 0,
+        0, 38125, 0, 0, 58839, 0, 58844, 58846, 0, 0,
+        36049, 58834, 0, 35007, 0, 0, 0, 0, 0, 0,
+        0, 58845, 0, 36313, 38900, 58847, 58848, 37269, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 38816, 0, 0,
+        0, 0, 58849, 38740, 0, 0, 58850, 58851, 0, 0,
+        38370, 58852, 0, 36286, 0, 38817, 0, 0, 0, 0,
+        0, 0, 58857, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 58858, 36822, 58856, 0, 0, 0, 38791, 58853,
+        0, 0, 58855, 37051, 37022, 0,
+    },
+    {
+        0, 0, 58854, 0, 58859, 0, 0, 38305, 0, 0,
+        58861, 0, 58860, 0, 0, 0, 35468, 0, 38474, 58862,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58874,
+        58864, 0, 0, 0, 0, 0, 0, 58865, 0, 0,
+        0, 0, 58866, 58867, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 58871, 0, 58872, 0, 0, 58870,
+        0, 0, 0, 0, 0, 58868, 0, 58863, 58869, 0,
+        0, 0, 0, 0, 0, 0, 58873, 59573, 0, 0,
+        0, 0, 0, 0, 0, 0, 35238, 0, 0, 0,
+        0, 0, 0, 0, 58876, 35805, 58875, 0, 0, 0,
+        58945, 0, 58944, 0, 0, 0, 58947, 0, 0, 58946,
+        0, 58948, 0, 0, 36688, 0, 58949, 0, 0, 58950,
+        0, 0, 0, 0, 0, 0, 58951, 37052, 0, 38774,
+        0, 58952, 0, 0, 38306, 37989, 58953, 0, 58954, 36009,
+        0, 0, 0, 35659, 0, 0, 0, 58955, 0, 0,
+        36491, 37984, 58956, 0, 35439, 0, 0, 0, 0, 0,
+        0, 58957, 0, 0, 0, 0, 58959, 38807, 0, 58958,
+        36965, 0, 58960, 0, 0, 58961, 0, 0, 58962, 35535,
+        0, 0, 0, 0, 0, 0, 58963, 0, 0, 58964,
+        0, 58965, 58966, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35440, 0, 0, 0, 0, 0, 0, 0, 58967, 0,
+        58968, 58969, 0, 0, 0, 0, 0, 35312, 0, 0,
+        36935, 58970, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 58971, 0, 0, 0, 58972, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        36030, 0, 37625, 58973, 0, 0, 0, 0, 35958, 0,
+        36981, 0, 58976, 0, 37794, 0, 58975, 0, 0, 35920,
+        0, 0, 58974, 37365, 35660, 0, 0, 58977, 0, 58978,
+        0, 36823, 0, 0, 0, 35981, 0, 58979, 0, 0,
+        0, 0, 38475, 0, 0, 37085, 0, 0, 0, 35734,
+        0, 38643, 37225, 0, 58980, 0, 0, 0, 36966, 37520,
+        36824, 0, 0, 0, 0, 58981, 0, 0, 0, 0,
+        58984, 0, 58985, 0, 0, 0, 0, 0, 0, 0,
+        36284, 37312, 58983, 0, 36825, 38237, 0, 0, 0, 0,
+        0, 58982, 0, 0, 36492, 0, 35186, 0, 58989, 35959,
+        0, 0, 36494, 0, 0, 36493, 0, 39020, 58988, 58987,
+        37190, 0, 35692, 39010, 35417, 36826, 0, 0, 0, 0,
+        0, 0, 0, 0, 58986, 0, 0, 0, 0, 0,
+        58991, 0, 58992, 58990, 0, 36054, 0, 38751, 0, 0,
+        36495, 37958, 0, 0, 0, 58995, 0, 37054, 0, 37473,
+        0, 0, 38741, 0, 58998, 0, 0, 0, 36074, 0,
+        37053, 58994, 0, 58999, 36075, 58996, 58997, 0, 58993, 0,
+        0, 0, 37088, 37831, 0, 0, 37454, 0, 35291, 0,
+        0, 0, 0, 0, 0, 38126, 0, 0, 35682, 0,
+        0, 37554, 0, 0, 59002, 0, 59000, 0, 0, 37483,
+        0, 0, 0, 37055, 35536, 59001, 0, 36986, 0, 0,
+        38856, 0, 0, 0, 39007, 0, 0, 0, 59003, 59015,
+        37555, 0, 59014, 0, 59011, 59019, 59012, 0, 59008, 0,
+        37626, 59006, 0, 0, 0, 59004, 0, 38720, 36496, 0,
+        0, 59009, 0, 59005, 0, 0, 0, 59013, 36756, 0,
+        36031, 0, 0, 0, 37368, 0,
+    },
+    {
+        38500, 35193, 35040, 0, 37795, 0, 0, 59017, 0, 0,
+        0, 0, 59016, 0, 37860, 0, 59021, 0, 0, 0,
+        59010, 0, 59020, 59022, 0, 36010, 59018, 36213, 0, 36563,
+        0, 0, 59023, 38775, 0, 0, 0, 0, 59026, 0,
+        59029, 0, 0, 59027, 38228, 0, 0, 0, 0, 0,
+        0, 59024, 0, 0, 0, 0, 0, 35806, 0, 0,
+        0, 0, 59028, 0, 0, 59030, 0, 0, 0, 0,
+        0, 0, 0, 59034, 0, 0, 59031, 0, 59033, 59032,
+        0, 0, 0, 0, 0, 0, 59035, 0, 36527, 0,
+        59037, 59036, 38280, 0, 0, 59039, 0, 0, 0, 0,
+        0, 0, 35960, 0, 0, 0, 0, 59038, 59040, 0,
+        0, 59041, 35683, 58303, 36855, 0, 59042, 0, 0, 36076,
+        0, 0, 0, 0, 0, 59043, 0, 0, 59044, 0,
+        0, 36445, 0, 0, 0, 0, 0, 0, 40396, 0,
+        59045, 0, 59046, 0, 36689, 0, 59047, 59048, 0, 0,
+        59049, 0, 0, 59050, 59051, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 37450, 0, 0, 59052, 0,
+        0, 0, 0, 59054, 0, 59053, 0, 0, 0, 0,
+        37796, 0, 59055, 0, 38476, 0, 59056, 0, 59057, 0,
+        59058, 0, 0, 0, 0, 59059, 0, 0, 0, 0,
+        37848, 0, 0, 0, 0, 0, 0, 36827, 59060, 0,
+        0, 0, 0, 0, 0, 0, 36235, 39084, 59061, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59062, 38238, 59063, 0, 59071, 0, 0, 0, 0, 0,
+        59064, 0, 0, 59066, 0, 0, 0, 59065, 59067, 0,
+        38501, 59068, 59069, 0, 0, 0, 0, 0, 59070, 0,
+        0, 0, 59072, 0, 0, 0, 0, 35404, 37605, 0,
+        38281, 36320, 36214, 0, 0, 0, 0, 38254, 35293, 38092,
+        59075, 35537, 37075, 59074, 59079, 37529, 38625, 0, 59077, 59078,
+        35661, 0, 59080, 38019, 37341, 0, 0, 38127, 37724, 59076,
+        0, 38502, 35306, 59082, 38983, 37568, 39012, 0, 0, 36497,
+        59081, 0, 37295, 0, 0, 59098, 37191, 0, 0, 37878,
+        0, 38255, 0, 0, 0, 0, 0, 0, 59085, 36446,
+        36498, 0, 36828, 0, 38021, 0, 36011, 59084, 59083, 0,
+        38282, 0, 0, 0, 36543, 0, 0, 37745, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59087, 59088, 36215, 59086, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 59089, 59090, 0, 59092, 37281, 0,
+        59091, 35556, 0, 59094, 0, 59093, 59095, 0, 0, 59097,
+        59099, 0, 59100, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        37076, 0, 36557, 59101, 0, 0, 0, 35441, 0, 59102,
+        0, 0, 37270, 59103, 0, 59104, 38283, 0, 0, 35662,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 59105,
+        0, 0, 0, 37556, 0, 0, 0, 0, 35194, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 59106, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 36591, 0, 0, 0, 0, 37014, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 37291,
+        0, 0, 0, 0, 0, 0, 59109, 0, 0, 0,
+        59108, 0, 0, 0, 59107, 0, 0, 0, 0, 0,
+        0, 0, 0, 59115, 59113, 0, 0, 59110, 0, 0,
+        0, 0, 0, 0, 59112, 0, 0, 0, 59111, 59114,
+        0, 35735, 0, 59118, 0, 37077, 0, 59119, 0, 0,
+        0, 0, 36055, 0, 59116, 59117, 0, 0, 0, 38984,
+        0, 0, 0, 37557, 0, 37192, 0, 0, 0, 0,
+        0, 0, 59120, 0, 0, 59123,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 59121, 59122,
+        38776, 0, 0, 0, 0, 37797, 59126, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 59124,
+        59125, 59127, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 59208, 0, 0, 0, 0, 0, 59130, 0,
+        0, 0, 59131, 59129, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 59128, 0, 37627, 0,
+        0, 59200, 59204, 59201, 59132, 0, 59202, 0, 0, 0,
+        59203, 0, 0, 0, 0, 59210, 0, 0, 0, 59205,
+        0, 0, 0, 0, 0, 37078, 59207, 0, 0, 59209,
+        59206, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 59212, 0, 36690, 0, 59211, 0,
+        0, 0, 0, 0, 59213, 0, 0, 0, 0, 59214,
+        0, 0, 59217, 59216, 0, 59215, 0, 0, 59219, 59218,
+        0, 38644, 0, 0, 0, 59221, 0, 59220, 59222, 0,
+        0, 0, 0, 59223, 0, 0, 0, 0, 0, 0,
+        0, 59225, 0, 0, 0, 0, 0, 0, 0, 0,
+        59224, 36967, 59226, 0, 0, 35819, 59227, 59229, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59230, 0, 0, 0, 0, 0, 0, 59231, 59228, 0,
+        59232, 0, 36564, 59233, 35663, 35922, 0, 0, 0, 0,
+        36012, 0, 0, 0, 0, 0, 0, 0, 0, 59234,
+        0, 0, 0, 37870, 0, 0, 37725, 59235, 0, 0,
+        0, 0, 0, 0, 0, 59238, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 36530, 0,
+        0, 59237, 59236, 35961, 59239, 0,
+    },
+    {
+        0, 0, 0, 35442, 0, 59241, 0, 0, 0, 36314,
+        59240, 0, 59249, 0, 0, 0, 0, 0, 59243, 59245,
+        38371, 59242, 0, 0, 0, 59244, 0, 59248, 59246, 35664,
+        0, 59247, 0, 0, 0, 0, 0, 0, 59250, 0,
+        0, 38009, 38870, 0, 0, 0, 0, 36691, 0, 0,
+        0, 59251, 0, 0, 0, 0, 38721, 59253, 0, 59252,
+        0, 0, 59256, 38752, 0, 0, 59255, 0, 35469, 59254,
+        59259, 0, 0, 59258, 0, 0, 59257, 37713, 59260, 0,
+        0, 0, 0, 0, 0, 0, 0, 59261, 0, 0,
+        0, 0, 59262, 0, 0, 36236, 0, 35908, 59264, 59265,
+        59266, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 36968, 59267, 0, 36523, 59268,
+        0, 0, 0, 59269, 0, 0, 0, 39327, 39326, 0,
+        0, 0, 0, 59270, 58256, 59271, 37443, 36938, 37983, 0,
+        0, 0, 0, 59272, 0, 0, 38355, 37586, 36254, 0,
+        0, 37448, 0, 0, 35145, 0, 38552, 36982, 0, 0,
+        0, 0, 0, 0, 0, 0, 35965, 0, 0, 35807,
+        0, 0, 38356, 0, 0, 0, 0, 0, 59273, 0,
+        0, 0, 0, 0, 0, 0, 59275, 0, 0, 59274,
+        35294, 0, 0, 37876, 59276, 38039, 0, 37714, 0, 59277,
+        36721, 0, 0, 0, 59279, 0, 0, 38592, 59294, 59281,
+        59282, 0, 0, 37575, 0, 0,
+    },
+    {
+        37342, 37271, 0, 37798, 0, 59280, 35700, 0, 0, 0,
+        0, 59289, 0, 59286, 59299, 37799, 37504, 59283, 0, 37628,
+        37746, 59284, 59288, 36992, 0, 38023, 37578, 0, 0, 37056,
+        59287, 37292, 37282, 59285, 34983, 38977, 0, 0, 0, 59290,
+        0, 0, 0, 0, 0, 0, 37343, 0, 0, 36692,
+        36969, 0, 0, 59292, 59291, 0, 35053, 59293, 0, 0,
+        38222, 0, 59301, 0, 0, 37849, 37003, 0, 0, 37496,
+        0, 35830, 0, 59300, 38742, 35166, 0, 38357, 35295, 59295,
+        59296, 59297, 59298, 37817, 37442, 35041, 59302, 0, 59303, 60065,
+        0, 0, 37307, 0, 59304, 0, 35219, 37227, 0, 36013,
+        0, 38777, 0, 0, 59305, 37707, 0, 0, 0, 37272,
+        36565, 59306, 0, 0, 59309, 0, 0, 36741, 59307, 37194,
+        37193, 0, 35042, 0, 38857, 59311, 0, 38128, 59313, 59312,
+        59310, 57988, 35538, 0, 0, 59278, 0, 59315, 59314, 0,
+        0, 0, 0, 59316, 0, 38743, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 37855, 0, 0, 38477, 0, 59317, 0,
+        36567, 0, 0, 0, 0, 59318, 0, 59319, 0, 0,
+        0, 59320, 0, 0, 37696, 0, 0, 0, 0, 0,
+        0, 0, 0, 35048, 0, 0, 0, 0, 0, 0,
+        0, 0, 36216, 0, 0, 0, 39001, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 59324,
+        0, 0, 0, 0, 0, 35923, 59321, 0, 59322, 0,
+        0, 0, 38292, 0, 0, 0, 0, 35443, 0, 0,
+        0, 0, 0, 0, 0, 38744, 0, 35773, 0, 0,
+        0, 0, 0, 37747, 0, 0,
+    },
+    {
+        0, 0, 59325, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 59326, 0,
+        0, 0, 0, 0, 0, 59327, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 37697, 0, 0, 59329, 0,
+        59328, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 37841, 59330, 36693, 36574, 38010, 37521, 0,
+        0, 0, 36592, 0, 37004, 0, 59331, 0, 59332, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 36988, 59333,
+        0, 59334, 0, 0, 0, 59335, 38799, 0, 36694, 0,
+        0, 0, 0, 0, 59337, 59336, 0, 36217, 0, 36243,
+        36447, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59340, 0, 0, 0, 0, 36742, 0, 59339, 0, 59338,
+        0, 37351, 0, 0, 36077, 0, 37057, 0, 0, 0,
+        0, 38062, 0, 0, 0, 0, 36696, 0, 0, 0,
+        0, 0, 59341, 0, 36829, 0, 0, 0, 0, 0,
+        59344, 59342, 0, 0, 0, 59343, 0, 0, 0, 0,
+        59346, 59345, 0, 0, 36856, 0, 59347, 0, 0, 0,
+        0, 0, 59348, 59349, 0, 0, 0, 0, 38094, 36305,
+        36575, 59350, 0, 59351, 38818, 36708, 38636, 38858, 59352, 35808,
+        0, 0, 0, 0, 59353, 0, 37698, 0, 0, 59356,
+        35480, 36970, 0, 59354, 0, 59355, 0, 37598, 0, 0,
+        38516, 35834, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59358, 59359, 0, 0, 0,
+        0, 0, 59357, 0, 0, 59361,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 37853, 35426, 0, 0, 59365, 0, 0,
+        59362, 59364, 0, 0, 0, 0, 0, 0, 0, 0,
+        59360, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 59502, 0, 0, 59363, 0, 0, 0, 0, 0,
+        0, 0, 38889, 0, 0, 36056, 0, 0, 0, 0,
+        0, 0, 0, 59373, 0, 0, 0, 0, 37715, 59368,
+        0, 0, 59371, 59369, 0, 59374, 0, 0, 0, 0,
+        59375, 0, 0, 0, 0, 0, 0, 59367, 0, 0,
+        59380, 35220, 0, 0, 59366, 0, 0, 0, 38059, 0,
+        59370, 0, 36830, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 36218, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 38503, 0, 35810, 0,
+        0, 36709, 0, 37818, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 37196, 0, 59378, 0, 59372,
+        59377, 0, 38593, 0, 37558, 59379, 59376, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 37195, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 59383, 0, 59382, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 59381, 0, 0,
+        38478, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 36763, 0,
+        0, 0, 0, 59384, 38365, 0, 0, 35187, 0, 0,
+        0, 0, 38245, 37522, 0, 0, 0, 0, 35736, 0,
+        59386, 0, 36220, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 36427, 0, 0, 0,
+        0, 0, 0, 0, 0, 59385, 37005, 0, 0, 0,
+        0, 0, 0, 0, 37006, 59456, 59458, 0, 0, 0,
+        0, 0, 36857, 0, 59457, 59459, 0, 0, 35793, 0,
+        38244, 0, 0, 36576, 38978, 0, 59388, 36342, 0, 0,
+        39006, 0, 0, 59461, 0, 0, 0, 0, 59460, 59462,
+        0, 0, 0, 0, 0, 0, 0, 0, 59387, 0,
+        0, 0, 0, 0, 0, 37863, 0, 37748, 0, 0,
+        0, 0, 0, 0, 37589, 0, 59467, 0, 0, 0,
+        0, 37474, 59463, 0, 0, 0, 59464, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 35916, 0,
+        59466, 0, 0, 0, 0, 0, 0, 36014, 0, 0,
+        0, 0, 0, 0, 59465, 0, 36831, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35481, 0, 0, 0, 0, 0, 0, 0, 59471, 0,
+        36285, 37273, 0, 0, 37576, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 35418, 0, 0,
+        0, 0, 59469, 59470, 37569, 0, 59468, 0, 0, 0,
+        0, 0, 0, 0, 0, 59472, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59478, 0, 0, 0, 0,
+        59481, 0, 0, 0, 0, 0, 0, 0, 59480, 37708,
+        0, 0, 0, 0, 59473, 59474, 59477, 0, 0, 0,
+        0, 59479, 0, 0, 0, 35774, 0, 0, 59482, 59476,
+        0, 0, 59475, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 59486, 0, 0, 0, 59487, 0, 0,
+        0, 0, 0, 0, 0, 0, 59488, 0, 0, 59485,
+        59484, 0, 0, 0, 36832, 37800, 59483, 0, 0, 0,
+        0, 0, 0, 59492, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 59490, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 59491, 59489, 0, 37366, 0, 59493, 0,
+        0, 0, 0, 0, 0, 59494, 0, 0, 59496, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 35539, 59495, 38648, 0, 0, 0, 0, 0, 0,
+        59507, 59497, 0, 0, 59500, 0, 59498, 0, 59499, 0,
+        0, 0, 0, 0, 0, 0, 59501, 0, 0, 0,
+        0, 0, 59503, 0, 0, 0, 0, 59504, 0, 59505,
+        0, 0, 0, 0, 59508, 59506, 59509, 59511, 0, 59510,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 37559,
+        0, 0, 0, 0, 0, 0, 0, 0, 38629, 0,
+        59512, 37197, 0, 0, 0, 59513, 0, 38338, 59514, 35402,
+        0, 0, 0, 35163, 0, 35541, 0, 35540, 59515, 0,
+        59516, 0, 59517, 59518, 0, 0, 0, 0, 0, 0,
+        59520, 0, 35542, 35444, 36221, 38068, 0, 59522, 59521, 0,
+        0, 0, 0, 59523, 0, 0, 0, 0, 35195, 0,
+        0, 0, 0, 0, 0, 59526, 0, 59525, 59524, 0,
+        59527, 0, 0, 0, 0, 59530, 0, 0, 0, 35013,
+        0, 0, 59528, 0, 59532, 59531, 0, 0, 0, 0,
+        0, 0, 59534, 59533, 59535, 0, 37804, 0, 0, 0,
+        59536, 0, 0, 0, 0, 59537, 59539, 0, 0, 59538,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 38284, 0,
+        0, 0, 0, 59540, 0, 0, 0, 0, 0, 0,
+        59541, 0, 36323, 0, 0, 0, 59542, 59543, 0, 0,
+        38504, 0, 0, 0, 0, 0, 0, 0, 0, 37226,
+        0, 0, 0, 34978, 37321, 0, 59544, 0, 38285, 0,
+        0, 0, 0, 0, 0, 59547, 59545, 36222, 0, 59546,
+        36032, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 38339, 59549, 59551, 59550, 59552, 0, 0, 35136, 36983,
+        36764, 35543, 59553, 0, 0, 0, 38022, 0, 59555, 0,
+        0, 0, 35137, 0, 59554, 37570, 0, 38859, 37801, 59548,
+        38820, 0, 36015, 0, 0, 38778, 0, 0, 0, 0,
+        0, 0, 0, 35831, 38834, 0, 35911, 0, 37344, 58432,
+        0, 59556, 35403, 37007, 0, 0, 0, 0, 35445, 59558,
+        0, 59559, 59557, 35972, 0, 36315, 36833, 0, 0, 0,
+        35138, 0, 0, 38871, 0, 0, 0, 59561, 59308, 0,
+        59560, 0, 0, 0, 0, 0, 59564, 59562, 59563, 0,
+        59565, 0, 59566, 38890, 59567, 59568, 0, 37063, 38073, 0,
+        0, 0, 37021, 35557, 0, 0, 38745, 35307, 36695, 36057,
+        0, 59571, 0, 59570, 36499, 59572, 59569, 0, 0, 36423,
+        0, 0, 0, 59576, 58795, 0, 0, 39380, 0, 37015,
+        59574, 0, 0, 0, 0, 0, 38819, 37871, 0, 0,
+        0, 0, 35146, 0, 37089, 36532, 0, 0, 0, 0,
+        38325, 0, 35167, 0, 0, 0, 38891, 38795, 0, 59577,
+        0, 37732, 0, 0, 0, 0,
+    },
+    {
+        36601, 0, 0, 0, 59578, 0, 59579, 36971, 59580, 0,
+        38892, 0, 0, 59575, 59582, 59584, 0, 59583, 0, 59581,
+        0, 0, 59585, 0, 0, 59586, 0, 0, 37274, 0,
+        35296, 0, 0, 0, 0, 0, 59587, 0, 0, 38582,
+        0, 0, 59588, 0, 0, 0, 0, 0, 59589, 0,
+        38985, 0, 0, 0, 0, 0, 40528, 59590, 0, 0,
+        0, 59591, 59592, 0, 0, 0, 59596, 0, 59593, 0,
+        59594, 0, 59595, 59597, 0, 0, 0, 0, 0, 0,
+        0, 0, 37058, 0, 0, 0, 38645, 0, 0, 37059,
+        0, 0, 59598, 0, 38129, 0, 59599, 60018, 38602, 0,
+        59600, 0, 59601, 0, 59602, 35446, 0, 59604, 0, 36984,
+        0, 0, 0, 59605, 0, 0, 35907, 0, 0, 0,
+        0, 59606, 59610, 0, 59608, 0, 0, 0, 0, 59609,
+        0, 0, 35475, 59607, 59611, 0, 0, 0, 0, 59612,
+        0, 35014, 0, 59613, 59614, 0, 0, 0, 0, 0,
+        0, 0, 36834, 0, 0, 0, 59615, 0, 0, 0,
+        35686, 0, 0, 59618, 0, 0, 59617, 0, 59616, 0,
+        0, 59025, 0, 38362, 0, 0, 0, 0, 0, 59619,
+        59620, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59621, 0, 0, 59622, 0,
+        59623, 0, 0, 59624, 0, 0, 0, 0, 0, 0,
+        0, 35544, 0, 0, 0, 0, 0, 0, 0, 0,
+        59625, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 59626, 37954, 0,
+        0, 0, 59628, 35257, 0, 59631, 59630, 0, 0, 0,
+        0, 35139, 0, 0, 0, 35775,
+    },
+    {
+        0, 38341, 37560, 36256, 0, 36224, 36743, 0, 36987, 0,
+        0, 0, 59633, 0, 0, 59632, 38753, 35558, 38096, 37850,
+        0, 0, 0, 37020, 38860, 0, 35962, 0, 0, 0,
+        0, 0, 0, 59636, 0, 0, 59635, 0, 0, 0,
+        0, 0, 0, 0, 38506, 37802, 0, 0, 0, 0,
+        0, 0, 35183, 0, 0, 59637, 59634, 0, 0, 38256,
+        38794, 59638, 0, 0, 0, 0, 0, 0, 0, 0,
+        59639, 0, 0, 0, 0, 59641, 37352, 35450, 35451, 59640,
+        0, 0, 0, 0, 35559, 36016, 0, 0, 35560, 0,
+        0, 37726, 0, 0, 38878, 0, 0, 0, 0, 0,
+        0, 0, 0, 36058, 0, 0, 0, 59642, 0, 0,
+        0, 59643, 59644, 59712, 0, 59714, 59713, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 38295, 0,
+        59715, 0, 0, 0, 0, 59716, 0, 59717, 0, 0,
+        0, 0, 59718, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59720, 59719, 0, 59721, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 38130,
+        58314, 0, 0, 36936, 0, 0, 35665, 0, 0, 0,
+        0, 0, 0, 59722, 0, 59723, 0, 39338, 40794, 38097,
+        0, 0, 35065, 0, 35001, 0, 0, 0, 0, 0,
+        0, 0, 36500, 38479, 36860, 0,
+    },
+    {
+        0, 0, 0, 59724, 0, 38621, 0, 0, 0, 59725,
+        38779, 0, 35169, 0, 0, 0, 36448, 0, 59726, 35308,
+        59727, 0, 0, 0, 59728, 0, 0, 0, 0, 59730,
+        59731, 0, 59733, 59729, 0, 0, 59732, 0, 0, 0,
+        35545, 0, 0, 0, 59734, 0, 59735, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 59736, 59737, 0, 0, 0, 59738, 0, 0, 59740,
+        0, 0, 0, 59739, 0, 59742, 59745, 0, 0, 0,
+        59741, 59743, 59744, 0, 0, 59746, 0, 35776, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        36593, 59747, 59748, 36225, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59749, 0, 0, 35421, 0,
+        0, 0, 37998, 59750, 59751, 0, 0, 0, 0, 37497,
+        37865, 0, 0, 0, 0, 0, 0, 0, 59752, 0,
+        0, 0, 0, 38045, 0, 0, 37322, 35191, 35820, 0,
+        35821, 0, 0, 0, 0, 0, 0, 0, 37523, 59757,
+        35822, 0, 0, 35309, 0, 0, 59756, 0, 0, 59754,
+        0, 59755, 0, 59753, 0, 0, 59767, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 59758, 59759, 0,
+        0, 59760, 59761, 0, 0, 0, 0, 0, 59763, 0,
+        0, 59762, 0, 0, 0, 36728,
+    },
+    {
+        0, 59764, 0, 0, 0, 59766, 0, 0, 0, 0,
+        0, 0, 0, 0, 35666, 59765, 0, 0, 37275, 36017,
+        0, 0, 0, 0, 0, 59768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        37323, 0, 0, 59769, 0, 0, 0, 0, 37803, 0,
+        0, 0, 0, 0, 0, 59770, 0, 0, 0, 0,
+        0, 0, 59776, 0, 59773, 0, 59772, 59774, 0, 59771,
+        0, 0, 0, 0, 0, 0, 0, 59778, 0, 0,
+        0, 0, 0, 0, 0, 59777, 0, 59780, 0, 0,
+        35777, 59779, 0, 0, 0, 59781, 0, 0, 59782, 0,
+        59784, 59783, 0, 0, 0, 59785, 59787, 59786, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 36252, 0,
+        0, 0, 0, 59788, 0, 0, 59789, 0, 0, 0,
+        0, 0, 0, 0, 35419, 0, 0, 0, 59790, 0,
+        0, 0, 59791, 0, 0, 0, 37009, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 59792, 0, 59793,
+        0, 59794, 59795, 0, 0, 0, 36226, 0, 0, 0,
+        0, 0, 59796, 59797, 0, 0, 59798, 59799, 0, 0,
+        59800, 0, 0, 0, 38063, 59802, 0, 38213, 59803, 59801,
+        0, 59805, 0, 0, 59804, 0, 0, 59806, 0, 0,
+        0, 59807, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 59808, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 59809, 0, 59810, 0, 0, 0,
+        0, 59811, 0, 0, 59812, 59813, 0, 59814, 0, 59815,
+        59816, 59817, 59818, 0, 0, 0, 59819, 59820, 0, 40788,
+        59821, 0, 0, 0, 0, 0, 0, 0, 0, 58102,
+        35667, 0, 0, 0, 0, 35392, 36272, 59823, 59822, 38563,
+        0, 0, 0, 0, 0, 0, 0, 59825, 59826, 59824,
+        0, 59827, 0, 0, 38530, 0, 0, 0, 59828, 0,
+        35739, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 38980, 0, 0, 0, 0, 59829, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 59831, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 35004, 0, 0, 59832, 38313, 59830, 0, 0,
+        59833, 59834, 0, 0, 0, 0, 0, 0, 0, 59835,
+        59836, 0, 0, 0, 0, 0, 0, 0, 59837, 0,
+        38542, 36428, 0, 36344, 37198, 0, 0, 0, 0, 0,
+        59838, 0, 0, 0, 0, 59841, 0, 0, 0, 0,
+        0, 0, 59839, 0, 0, 0, 0, 0, 59842, 0,
+        0, 36079, 59840, 0, 0, 0, 0, 59843, 0, 59844,
+        59845, 0, 59849, 0, 36425, 0, 0, 0, 0, 37346,
+        0, 0, 0, 0, 0, 59850, 59847, 59846, 59848, 0,
+        0, 0, 35966, 0, 0, 0, 0, 0, 0, 0,
+        59854, 59853, 59852, 0, 0, 34993, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 59864, 0, 59860, 0, 59861, 59857,
+        59863, 0, 59859, 35458, 0, 0, 39019, 0, 59862, 59858,
+        59856, 59855, 0, 0, 0, 0, 0, 59866, 0, 0,
+        0, 0, 0, 59869, 0, 0, 59868, 59867, 0, 0,
+        0, 0, 0, 0, 0, 38248, 59865, 35057, 59870, 0,
+        59872, 0, 0, 0, 0, 0, 0, 35471, 59851, 35158,
+        0, 0, 59874, 0, 0, 0, 0, 0, 0, 0,
+        59873, 59871, 37452, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 38544, 0, 0, 0, 0, 38872, 0, 0,
+        59875, 0, 0, 0, 0, 0, 59876, 0, 0, 0,
+        0, 0, 0, 59877, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 59878, 0,
+        59879, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 37561,
+        0, 59880, 0, 38069, 0, 59885, 59881, 0, 0, 0,
+        59882, 0, 0, 38480, 38594, 0, 37838, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 59886, 0, 0, 59887, 37820, 59884, 59883,
+        0, 0, 0, 0, 35240, 0, 0, 0, 59895, 0,
+        0, 59894, 0, 0, 0, 0, 0, 35221, 0, 0,
+        0, 59892, 0, 0, 0, 59891, 0, 0, 59889, 0,
+        35483, 0, 59888, 36528, 35239, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 36227,
+        0, 0, 59898, 59897, 0, 59896, 0, 0, 59893, 0,
+        59899, 0, 59900, 0, 0, 0, 0, 0, 0, 0,
+        59972, 59971, 0, 0, 0, 0, 0, 0, 0, 59973,
+        0, 0, 35148, 59968, 59969, 0, 36244, 38583, 0, 0,
+        59970, 0, 0, 0, 0, 0, 0, 0, 38481, 0,
+        0, 59978, 0, 0, 59974, 0, 0, 0, 0, 0,
+        0, 0, 59979, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59976, 0, 59975, 0, 0,
+        0, 0, 0, 35963, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 59980, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 59981, 0, 0, 0, 0, 59982,
+        0, 59977, 0, 0, 0, 59890, 0, 0, 59983, 0,
+        37599, 0, 0, 0, 59987, 0, 59988, 59986, 0, 0,
+        0, 0, 0, 59985, 59991, 0, 59984, 0, 59989, 0,
+        0, 0, 0, 0, 0, 0, 0, 59990, 0, 0,
+        0, 59993, 0, 0, 0, 0, 0, 59992, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59995, 0, 0, 0, 0, 0, 0, 59996, 0, 59997,
+        0, 0, 39016, 0, 0, 0, 0, 0, 59994, 37353,
+        36331, 0, 0, 59998, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 59999, 60000, 0, 0,
+        60001, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 60002, 0, 0,
+        36018, 60003, 0, 0, 0, 60004, 0, 36525, 0, 60005,
+        0, 0, 0, 0, 0, 0, 60006, 0, 0, 60007,
+        60008, 0, 0, 0, 0, 60011, 60009, 39003, 0, 60010,
+        0, 38893, 0, 0, 0, 0, 0, 60012, 0, 38873,
+        0, 0, 0, 0, 0, 60013, 38046, 0, 0, 60014,
+        60016, 0, 0, 60017, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 60015, 36237, 38603, 38531, 39925, 0,
+        40832, 38555, 0, 0, 0, 0, 35241, 0, 0, 0,
+        0, 0, 0, 0, 60019, 35695, 60020, 60021, 60022, 0,
+        36245, 0, 60023, 0, 0, 0, 57554, 38617, 0, 37345,
+        60024, 60026, 60025, 0, 60027, 0, 0, 0, 0, 60028,
+        0, 0, 60029, 0, 0, 0, 0, 0, 0, 60030,
+        0, 0, 0, 0, 60032, 0, 60033, 60034, 0, 60035,
+        0, 60036, 60037, 60038, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 60039, 60040, 0,
+        0, 0, 0, 0, 37699, 0, 0, 0, 0, 36059,
+        0, 60042, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 37228, 60043, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 60044, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 38208,
+        0, 0, 60045, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 60046, 57942, 0, 0, 59096, 59627,
+        0, 0, 60047, 0, 60048, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 60050, 60051, 60052, 38894, 60049,
+        0, 0, 60053, 60054, 0, 0, 60056, 0, 60055, 0,
+        0, 0, 0, 0, 60058, 0, 0, 0, 60059, 60057,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 38836, 0, 0, 0, 0, 0, 0, 0, 60060,
+        0, 0, 0, 0, 0, 0, 60061, 57971, 0, 0,
+        60062, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 33097, 0, 33172, 33168, 33171, 33173, 0, 33129, 33130,
+        33174, 33147, 33091, 0, 33092, 33118, 33359, 33360, 33361, 33362,
+        33363, 33364, 33365, 33366, 33367, 33368, 33094, 33095, 33155, 33153,
+        33156, 33096, 33175, 33376, 33377, 33378, 33379, 33380, 33381, 33382,
+        33383, 33384, 33385, 33386, 33387, 33388, 33389, 33390, 33391, 33392,
+        33393, 33394, 33395, 33396, 33397, 33398, 33399, 33400, 33401, 33133,
+        0, 33134, 33103, 33105, 33101, 33409, 33410, 33411, 33412, 33413,
+        33414, 33415, 33416, 33417, 33418, 33419, 33420, 33421, 33422, 33423,
+        33424, 33425, 33426, 33427, 33428, 33429, 33430, 33431, 33432, 33433,
+        33434, 33135, 33122, 33136, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 33104, 0, 33167,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+    },
+};
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# Generates revsjis.h, a direct index from Unicode to Shift_JIS over every
+# character of jis0208.h, for iconv.c's Shift_JIS output. Run from this
+# directory after editing jis0208.h:
+#
+#   python3 revsjis.py jis0208.h > revsjis.h
+#
+# Code points are split by their high byte into pages of 256 entries, each
+# holding the two Shift_JIS bytes of a character, or 0 if it has none. Pages
+# without any character share the empty page 0.
+
+import re
+import sys
+
+ROWS = 84
+COLUMNS = 94
+
+
+def read_jis0208(path):
+    with open(path) as f:
+        source = f.read()
+    body = source[source.index("{") :]
+    values = [int(v) for v in re.findall(r"\d+", body)]
+    if len(values) != ROWS * COLUMNS:
+        sys.exit("jis0208.h holds %d entries, not %d" % (len(values), ROWS * COLUMNS))
+    return values
+
+
+def sjis(row, column):
+    """Encodes a JIS X 0208 position as iconv.c did."""
+    c = row + 0x21
+    d = column + 0x21
+    lead = (c + 1) // 2 + (112 if c < 95 else 176)
+    trail = d + 31 + d // 96 if c % 2 else d + 126
+    return lead << 8 | trail
+
+
+def main():
+    values = read_jis0208(sys.argv[1])
+
+    codes = {}
+    for i, c in enumerate(values):
+        if not c:
+            continue
+        if c in codes:
+            sys.exit("U+%04X appears twice within jis0208.h" % c)
+        codes[c] = sjis(i // COLUMNS, i % COLUMNS)
+
+    high = sorted({c >> 8 for c in codes})
+    index = [0] * 256
+    for page, h in enumerate(high, 1):
+        index[h] = page
+
+    out = []
+    emit = out.append
+    emit(
+        "/* This is a generated file! Please edit jis0208.h and use "
+        "revsjis.py to rebuild */"
+    )
+    emit("")
+    emit("/* Page of each code point's high byte within rev_sjis. */")
+    emit("static const unsigned char rev_sjis_index[256] = {")
+    for i in range(0, 256, 16):
+        emit("    " + " ".join("%d," % p for p in index[i : i + 16]))
+    emit("};")
+    emit("")
+    emit("static const unsigned short rev_sjis[%d][256] = {" % (len(high) + 1))
+    emit("    {0},")
+    for h in high:
+        page = [codes.get(h << 8 | l, 0) for l in range(256)]
+        emit("    {")
+        for i in range(0, 256, 10):
+            emit("        " + " ".join("%d," % v for v in page[i : i + 10]))
+        emit("    },")
+    emit("};")
+
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,35 +1,140 @@
-// This is a generated file! Please edit source .ksy file and use kaitai-struct-compiler to rebuild
+// This file was generated from pd.ksy by kaitai-struct-compiler, then tuned by hand
+// to parse in place. Please keep it in sync with pd.ksy when editing either.
 
 #include "pd.h"
 #include "kaitai/exceptions.h"
 
+// Built with KS_NO_EXCEPTIONS, failures are recorded against the root
+// pd_t with the KSY path of the failing field rather than thrown. Parsing
+// carries on with empty values, keeping only the first failure.
+#ifdef KS_NO_EXCEPTIONS
+#define PD_ENSURE_EQUAL(actual, expected, length, path) \
+    do { \
+        if (actual != kaitai::bytes_span(expected, length)) { \
+            m__root->m__status.fail("validation_not_equal_error", path); \
+        } \
+    } while (0)
+#define PD_ENSURE_IO(io, path) \
+    do { \
+        if (!(io)->status().ok()) { \
+            m__root->m__status.fail((io)->status().message(), path); \
+        } \
+    } while (0)
+#else
+#define PD_ENSURE_EQUAL(actual, expected, length, path) \
+    do { \
+        if (actual != kaitai::bytes_span(expected, length)) { \
+            throw kaitai::validation_not_equal_error<std::string>(std::string(expected, length), actual.str(), _io(), std::string(path)); \
+        } \
+    } while (0)
+#define PD_ENSURE_IO(io, path) do { } while (0)
+#endif
+
+#define PD_READ_STR(length, path) \
+    kaitai::kstream::bytes_to_str(m__io->read_bytes_span(length), "UTF-16BE", &m__root->m__status, path)
+
 pd_t::pd_t(kaitai::kstream* p__io, kaitai::kstruct* p__parent, pd_t* p__root) : kaitai::kstruct(p__io) {
     m__parent = p__parent;
     m__root = this;
+    f_file_header = false;
     m_file_header = nullptr;
     m__io__raw_file_header = nullptr;
+    f_pin_block = false;
     m_pin_block = nullptr;
     m__io__raw_pin_block = nullptr;
+    f_info = false;
     m_info = nullptr;
     m__io__raw_info = nullptr;
+    f_kana = false;
     m_kana = nullptr;
     m__io__raw_kana = nullptr;
+    m__start = m__io->pos();
     _read();
 }
 
+pd_t::pd_t(kaitai::kstream* p__io, parse_mode_t p_mode) : kaitai::kstruct(p__io) {
+    m__parent = nullptr;
+    m__root = this;
+    f_file_header = false;
+    m_file_header = nullptr;
+    m__io__raw_file_header = nullptr;
+    f_pin_block = false;
+    m_pin_block = nullptr;
+    m__io__raw_pin_block = nullptr;
+    f_info = false;
+    m_info = nullptr;
+    m__io__raw_info = nullptr;
+    f_kana = false;
+    m_kana = nullptr;
+    m__io__raw_kana = nullptr;
+    m__start = m__io->pos();
+    if (p_mode == PARSE_EAGER) {
+        _read();
+    }
+}
+
 void pd_t::_read() {
-    m__raw_file_header = m__io->read_bytes(5);
-    m__io__raw_file_header = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_file_header));
+    file_header();
+    pin_block();
+    info();
+    kana();
+    m__io->seek(m__start + 10747);
+}
+
+pd_t::header_t* pd_t::file_header() {
+    if (f_file_header)
+        return m_file_header.get();
+    uint64_t _pos = m__io->pos();
+    m__io->seek(m__start + 0);
+    m__raw_file_header = m__io->read_bytes_span(5);
+    PD_ENSURE_IO(m__io, "/seq/0");
+    m__io__raw_file_header = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_file_header.data(), m__raw_file_header.size()));
     m_file_header = std::unique_ptr<header_t>(new header_t(m__io__raw_file_header.get(), this, m__root));
-    m__raw_pin_block = m__io->read_bytes(123);
-    m__io__raw_pin_block = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_pin_block));
+    m__io->seek(_pos);
+    f_file_header = true;
+    return m_file_header.get();
+}
+
+pd_t::pin_block_t* pd_t::pin_block() {
+    if (f_pin_block)
+        return m_pin_block.get();
+    uint64_t _pos = m__io->pos();
+    m__io->seek(m__start + 5);
+    m__raw_pin_block = m__io->read_bytes_span(123);
+    PD_ENSURE_IO(m__io, "/seq/1");
+    m__io__raw_pin_block = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_pin_block.data(), m__raw_pin_block.size()));
     m_pin_block = std::unique_ptr<pin_block_t>(new pin_block_t(m__io__raw_pin_block.get(), this, m__root));
-    m__raw_info = m__io->read_bytes(9583);
-    m__io__raw_info = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_info));
+    m__io->seek(_pos);
+    f_pin_block = true;
+    return m_pin_block.get();
+}
+
+pd_t::info_block_t* pd_t::info() {
+    if (f_info)
+        return m_info.get();
+    uint64_t _pos = m__io->pos();
+    m__io->seek(m__start + 128);
+    m__raw_info = m__io->read_bytes_span(9583);
+    PD_ENSURE_IO(m__io, "/seq/2");
+    m__io__raw_info = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_info.data(), m__raw_info.size()));
     m_info = std::unique_ptr<info_block_t>(new info_block_t(m__io__raw_info.get(), this, m__root));
-    m__raw_kana = m__io->read_bytes(1036);
-    m__io__raw_kana = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_kana));
+    m__io->seek(_pos);
+    f_info = true;
+    return m_info.get();
+}
+
+pd_t::kana_block_t* pd_t::kana() {
+    if (f_kana)
+        return m_kana.get();
+    uint64_t _pos = m__io->pos();
+    m__io->seek(m__start + 9711);
+    m__raw_kana = m__io->read_bytes_span(1036);
+    PD_ENSURE_IO(m__io, "/seq/3");
+    m__io__raw_kana = std::unique_ptr<kaitai::kstream>(new kaitai::kstream(m__raw_kana.data(), m__raw_kana.size()));
     m_kana = std::unique_ptr<kana_block_t>(new kana_block_t(m__io__raw_kana.get(), this, m__root));
+    m__io->seek(_pos);
+    f_kana = true;
+    return m_kana.get();
 }
 
 pd_t::~pd_t() {
@@ -46,14 +151,11 @@ pd_t::header_t::header_t(kaitai::kstream* p__io, pd_t* p__parent, pd_t* p__root)
 }
 
 void pd_t::header_t::_read() {
-    m_magic = m__io->read_bytes(4);
-    if (!(magic() == std::string("\x50\x44\x46\x46", 4))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x50\x44\x46\x46", 4), magic(), _io(), std::string("/types/header/seq/0"));
-    }
-    m_version = m__io->read_bytes(1);
-    if (!(version() == std::string("\x02", 1))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x02", 1), version(), _io(), std::string("/types/header/seq/1"));
-    }
+    m_magic = m__io->read_bytes_span(4);
+    PD_ENSURE_EQUAL(magic(), "\x50\x44\x46\x46", 4, "/types/header/seq/0");
+    m_version = m__io->read_bytes_span(1);
+    PD_ENSURE_EQUAL(version(), "\x02", 1, "/types/header/seq/1");
+    PD_ENSURE_IO(m__io, "/types/header");
 }
 
 pd_t::header_t::~header_t() {
@@ -70,13 +172,14 @@ pd_t::pin_block_t::pin_block_t(kaitai::kstream* p__io, pd_t* p__parent, pd_t* p_
 }
 
 void pd_t::pin_block_t::_read() {
-    m_pin_magic = m__io->read_bytes(12);
-    m_padding = m__io->read_bytes(8);
+    m_pin_magic = m__io->read_bytes_span(12);
+    m_padding = m__io->read_bytes_span(8);
     n_pin = true;
-    if (pin_magic() != std::string("\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 12)) {
+    if (pin_magic() != kaitai::bytes_span("\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 12)) {
         n_pin = false;
-        m_pin = kaitai::kstream::bytes_to_str(m__io->read_bytes(8), std::string("UTF-16BE"));
+        m_pin = PD_READ_STR(8, "/types/pin_block/seq/2");
     }
+    PD_ENSURE_IO(m__io, "/types/pin_block");
 }
 
 pd_t::pin_block_t::~pin_block_t() {
@@ -95,33 +198,28 @@ pd_t::info_block_t::info_block_t(kaitai::kstream* p__io, pd_t* p__parent, pd_t*
 }
 
 void pd_t::info_block_t::_read() {
-    m_magic = m__io->read_bytes(4);
-    if (!(magic() == std::string("\x49\x4E\x46\x4F", 4))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x49\x4E\x46\x4F", 4), magic(), _io(), std::string("/types/info_block/seq/0"));
-    }
+    m_magic = m__io->read_bytes_span(4);
+    PD_ENSURE_EQUAL(magic(), "\x49\x4E\x46\x4F", 4, "/types/info_block/seq/0");
     m_block_size = m__io->read_u4be();
     m_intentionally_null = m__io->read_u4be();
-    m_preset_values = m__io->read_bytes(3);
-    if (!(preset_values() == std::string("\x01\x08\x00", 3))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x01\x08\x00", 3), preset_values(), _io(), std::string("/types/info_block/seq/3"));
-    }
+    m_preset_values = m__io->read_bytes_span(3);
+    PD_ENSURE_EQUAL(preset_values(), "\x01\x08\x00", 3, "/types/info_block/seq/3");
     m_first_timestamp = m__io->read_u8be();
-    m_profile_name = kaitai::kstream::bytes_to_str(m__io->read_bytes(56), std::string("UTF-16BE"));
-    m_surname = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
-    m_first_name = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
-    m_postal_code = kaitai::kstream::bytes_to_str(m__io->read_bytes(34), std::string("UTF-16BE"));
+    m_profile_name = PD_READ_STR(56, "/types/info_block/seq/5");
+    m_surname = PD_READ_STR(64, "/types/info_block/seq/6");
+    m_first_name = PD_READ_STR(64, "/types/info_block/seq/7");
+    m_postal_code = PD_READ_STR(34, "/types/info_block/seq/8");
     m_padding_null = m__io->read_u2be();
-    m_state_or_prefecture = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
-    m_city = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
-    m_home_address = kaitai::kstream::bytes_to_str(m__io->read_bytes(256), std::string("UTF-16BE"));
-    m_apartment_number = kaitai::kstream::bytes_to_str(m__io->read_bytes(256), std::string("UTF-16BE"));
-    m_phone_number = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
-    m_email_address = kaitai::kstream::bytes_to_str(m__io->read_bytes(256), std::string("UTF-16BE"));
-    m_padding = m__io->read_bytes(1);
-    if (!(padding() == std::string("\x00", 1))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x00", 1), padding(), _io(), std::string("/types/info_block/seq/16"));
-    }
+    m_state_or_prefecture = PD_READ_STR(64, "/types/info_block/seq/10");
+    m_city = PD_READ_STR(64, "/types/info_block/seq/11");
+    m_home_address = PD_READ_STR(256, "/types/info_block/seq/12");
+    m_apartment_number = PD_READ_STR(256, "/types/info_block/seq/13");
+    m_phone_number = PD_READ_STR(64, "/types/info_block/seq/14");
+    m_email_address = PD_READ_STR(256, "/types/info_block/seq/15");
+    m_padding = m__io->read_bytes_span(1);
+    PD_ENSURE_EQUAL(padding(), "\x00", 1, "/types/info_block/seq/16");
     m_second_timestamp = m__io->read_u8be();
+    PD_ENSURE_IO(m__io, "/types/info_block");
 }
 
 pd_t::info_block_t::~info_block_t() {
@@ -138,17 +236,14 @@ pd_t::kana_block_t::kana_block_t(kaitai::kstream* p__io, pd_t* p__parent, pd_t*
 }
 
 void pd_t::kana_block_t::_read() {
-    m_magic = m__io->read_bytes(4);
-    if (!(magic() == std::string("\x4B\x41\x4E\x41", 4))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x4B\x41\x4E\x41", 4), magic(), _io(), std::string("/types/kana_block/seq/0"));
-    }
+    m_magic = m__io->read_bytes_span(4);
+    PD_ENSURE_EQUAL(magic(), "\x4B\x41\x4E\x41", 4, "/types/kana_block/seq/0");
     m_block_size = m__io->read_u4be();
-    m_preset_value = m__io->read_bytes(4);
-    if (!(preset_value() == std::string("\x01\x00\x00\x00", 4))) {
-        throw kaitai::validation_not_equal_error<std::string>(std::string("\x01\x00\x00\x00", 4), preset_value(), _io(), std::string("/types/kana_block/seq/2"));
-    }
-    m_surname = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
-    m_first_name = kaitai::kstream::bytes_to_str(m__io->read_bytes(64), std::string("UTF-16BE"));
+    m_preset_value = m__io->read_bytes_span(4);
+    PD_ENSURE_EQUAL(preset_value(), "\x01\x00\x00\x00", 4, "/types/kana_block/seq/2");
+    m_surname = PD_READ_STR(64, "/types/kana_block/seq/3");
+    m_first_name = PD_READ_STR(64, "/types/kana_block/seq/4");
+    PD_ENSURE_IO(m__io, "/types/kana_block");
 }
 
 pd_t::kana_block_t::~kana_block_t() {
@@ -1,6 +1,7 @@
 #pragma once
 
-// This is a generated file! Please edit source .ksy file and use kaitai-struct-compiler to rebuild
+// This file was generated from pd.ksy by kaitai-struct-compiler, then tuned by hand
+// to parse in place. Please keep it in sync with pd.ksy when editing either.
 
 #include "kaitai/kaitaistruct.h"
 #include <stdint.h>
@@ -18,7 +19,17 @@ public:
     class info_block_t;
     class kana_block_t;
 
+    /**
+     * PARSE_LAZY defers parsing each block until its accessor is first
+     * called, such that reading only the PIN touches only its block.
+     */
+    enum parse_mode_t {
+        PARSE_EAGER,
+        PARSE_LAZY,
+    };
+
     pd_t(kaitai::kstream* p__io, kaitai::kstruct* p__parent = nullptr, pd_t* p__root = nullptr);
+    pd_t(kaitai::kstream* p__io, parse_mode_t p_mode);
 
 private:
     void _read();
@@ -41,18 +52,18 @@ public:
         ~header_t();
 
     private:
-        std::string m_magic;
-        std::string m_version;
+        kaitai::bytes_span m_magic;
+        kaitai::bytes_span m_version;
         pd_t* m__root;
         pd_t* m__parent;
 
     public:
-        std::string magic() const { return m_magic; }
+        kaitai::bytes_span magic() const { return m_magic; }
 
         /**
          * <| This is checked by all known PD SDKs to be less than or equal to 2. It's assumed that 1 exists with lesser features - presumably without profiles.
          */
-        std::string version() const { return m_version; }
+        kaitai::bytes_span version() const { return m_version; }
         pd_t* _root() const { return m__root; }
         pd_t* _parent() const { return m__parent; }
     };
@@ -71,8 +82,8 @@ public:
         ~pin_block_t();
 
     private:
-        std::string m_pin_magic;
-        std::string m_padding;
+        kaitai::bytes_span m_pin_magic;
+        kaitai::bytes_span m_padding;
         std::string m_pin;
         bool n_pin;
 
@@ -84,9 +95,9 @@ public:
         pd_t* m__parent;
 
     public:
-        std::string pin_magic() const { return m_pin_magic; }
-        std::string padding() const { return m_padding; }
-        std::string pin() const { return m_pin; }
+        kaitai::bytes_span pin_magic() const { return m_pin_magic; }
+        kaitai::bytes_span padding() const { return m_padding; }
+        const std::string& pin() const { return m_pin; }
         pd_t* _root() const { return m__root; }
         pd_t* _parent() const { return m__parent; }
     };
@@ -105,10 +116,10 @@ public:
         ~info_block_t();
 
     private:
-        std::string m_magic;
+        kaitai::bytes_span m_magic;
         uint32_t m_block_size;
         uint32_t m_intentionally_null;
-        std::string m_preset_values;
+        kaitai::bytes_span m_preset_values;
         uint64_t m_first_timestamp;
         std::string m_profile_name;
         std::string m_surname;
@@ -121,49 +132,49 @@ public:
         std::string m_apartment_number;
         std::string m_phone_number;
         std::string m_email_address;
-        std::string m_padding;
+        kaitai::bytes_span m_padding;
         uint64_t m_second_timestamp;
         pd_t* m__root;
         pd_t* m__parent;
 
     public:
-        std::string magic() const { return m_magic; }
+        kaitai::bytes_span magic() const { return m_magic; }
         uint32_t block_size() const { return m_block_size; }
         uint32_t intentionally_null() const { return m_intentionally_null; }
 
         /**
          * These do not appear to be read yet are set if uninitialized.
          */
-        std::string preset_values() const { return m_preset_values; }
+        kaitai::bytes_span preset_values() const { return m_preset_values; }
         uint64_t first_timestamp() const { return m_first_timestamp; }
 
         /**
          * This is used within additional profiles. We do not support it.
          */
-        std::string profile_name() const { return m_profile_name; }
+        const std::string& profile_name() const { return m_profile_name; }
 
         /**
          * Tyically written with Romaji.
          */
-        std::string surname() const { return m_surname; }
+        const std::string& surname() const { return m_surname; }
 
         /**
          * Tyically written with Romaji.
          */
-        std::string first_name() const { return m_first_name; }
-        std::string postal_code() const { return m_postal_code; }
+        const std::string& first_name() const { return m_first_name; }
+        const std::string& postal_code() const { return m_postal_code; }
         uint16_t padding_null() const { return m_padding_null; }
 
         /**
          * <| The first two bytes of this string (overlapping with padding_null above) are hardcoded to 0x019e. However, the 0x9e is used within the prefecture's name.
          */
-        std::string state_or_prefecture() const { return m_state_or_prefecture; }
-        std::string city() const { return m_city; }
-        std::string home_address() const { return m_home_address; }
-        std::string apartment_number() const { return m_apartment_number; }
-        std::string phone_number() const { return m_phone_number; }
-        std::string email_address() const { return m_email_address; }
-        std::string padding() const { return m_padding; }
+        const std::string& state_or_prefecture() const { return m_state_or_prefecture; }
+        const std::string& city() const { return m_city; }
+        const std::string& home_address() const { return m_home_address; }
+        const std::string& apartment_number() const { return m_apartment_number; }
+        const std::string& phone_number() const { return m_phone_number; }
+        const std::string& email_address() const { return m_email_address; }
+        kaitai::bytes_span padding() const { return m_padding; }
         uint64_t second_timestamp() const { return m_second_timestamp; }
         pd_t* _root() const { return m__root; }
         pd_t* _parent() const { return m__parent; }
@@ -183,57 +194,69 @@ public:
         ~kana_block_t();
 
     private:
-        std::string m_magic;
+        kaitai::bytes_span m_magic;
         uint32_t m_block_size;
-        std::string m_preset_value;
+        kaitai::bytes_span m_preset_value;
         std::string m_surname;
         std::string m_first_name;
         pd_t* m__root;
         pd_t* m__parent;
 
     public:
-        std::string magic() const { return m_magic; }
+        kaitai::bytes_span magic() const { return m_magic; }
         uint32_t block_size() const { return m_block_size; }
 
         /**
          * <| The literal 0x1 is additionally written over 1 byte via memcpy. As this area has been memset to 0 prior to run and never modified, we assume the next few bytes are null as well.
          */
-        std::string preset_value() const { return m_preset_value; }
-        std::string surname() const { return m_surname; }
-        std::string first_name() const { return m_first_name; }
+        kaitai::bytes_span preset_value() const { return m_preset_value; }
+        const std::string& surname() const { return m_surname; }
+        const std::string& first_name() const { return m_first_name; }
         pd_t* _root() const { return m__root; }
         pd_t* _parent() const { return m__parent; }
     };
 
 private:
+    bool f_file_header;
     std::unique_ptr<header_t> m_file_header;
+    bool f_pin_block;
     std::unique_ptr<pin_block_t> m_pin_block;
+    bool f_info;
     std::unique_ptr<info_block_t> m_info;
+    bool f_kana;
     std::unique_ptr<kana_block_t> m_kana;
+    uint64_t m__start;
+    kaitai::parse_status m__status;
     pd_t* m__root;
     kaitai::kstruct* m__parent;
-    std::string m__raw_file_header;
+    kaitai::bytes_span m__raw_file_header;
     std::unique_ptr<kaitai::kstream> m__io__raw_file_header;
-    std::string m__raw_pin_block;
+    kaitai::bytes_span m__raw_pin_block;
     std::unique_ptr<kaitai::kstream> m__io__raw_pin_block;
-    std::string m__raw_info;
+    kaitai::bytes_span m__raw_info;
     std::unique_ptr<kaitai::kstream> m__io__raw_info;
-    std::string m__raw_kana;
+    kaitai::bytes_span m__raw_kana;
     std::unique_ptr<kaitai::kstream> m__io__raw_kana;
 
 public:
-    header_t* file_header() const { return m_file_header.get(); }
-    pin_block_t* pin_block() const { return m_pin_block.get(); }
-    info_block_t* info() const { return m_info.get(); }
-    kana_block_t* kana() const { return m_kana.get(); }
+    header_t* file_header();
+    pin_block_t* pin_block();
+    info_block_t* info();
+    kana_block_t* kana();
+
+    /**
+     * The first failure while parsing, and the KSY path of the failing
+     * field. Only ever unsuccessful when built with KS_NO_EXCEPTIONS.
+     */
+    const kaitai::parse_status& _status() const { return m__status; }
     pd_t* _root() const { return m__root; }
     kaitai::kstruct* _parent() const { return m__parent; }
-    std::string _raw_file_header() const { return m__raw_file_header; }
+    kaitai::bytes_span _raw_file_header() const { return m__raw_file_header; }
     kaitai::kstream* _io__raw_file_header() const { return m__io__raw_file_header.get(); }
-    std::string _raw_pin_block() const { return m__raw_pin_block; }
+    kaitai::bytes_span _raw_pin_block() const { return m__raw_pin_block; }
     kaitai::kstream* _io__raw_pin_block() const { return m__io__raw_pin_block.get(); }
-    std::string _raw_info() const { return m__raw_info; }
+    kaitai::bytes_span _raw_info() const { return m__raw_info; }
     kaitai::kstream* _io__raw_info() const { return m__io__raw_info.get(); }
-    std::string _raw_kana() const { return m__raw_kana; }
+    kaitai::bytes_span _raw_kana() const { return m__raw_kana; }
     kaitai::kstream* _io__raw_kana() const { return m__io__raw_kana.get(); }
 };
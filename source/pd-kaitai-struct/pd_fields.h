@@ -0,0 +1,235 @@
+#pragma once
+
+// This is a generated file! Please edit source .ksy file and use pd_fields.py to rebuild
+
+#include <stddef.h>
+
+enum pd_encoding_t {
+    PD_ENCODING_CONTENTS,
+    PD_ENCODING_BYTES,
+    PD_ENCODING_U1,
+    PD_ENCODING_U2BE,
+    PD_ENCODING_U4BE,
+    PD_ENCODING_U8BE,
+    PD_ENCODING_UTF16BE,
+};
+
+struct pd_block_t {
+    const char *name;
+    size_t offset;
+    size_t length;
+};
+
+struct pd_field_t {
+    const char *name;
+    size_t offset;
+    size_t length;
+    pd_encoding_t encoding;
+    // Expected bytes for PD_ENCODING_CONTENTS, otherwise nullptr.
+    const char *contents;
+    // Whether this field is only present under a condition.
+    bool conditional;
+    // Offset of the KANA block's copy of this field, or 0 if none.
+    size_t kana_offset;
+};
+
+enum pd_block_id_t {
+    PD_BLOCK_FILE_HEADER,
+    PD_BLOCK_PIN_BLOCK,
+    PD_BLOCK_INFO,
+    PD_BLOCK_KANA,
+    PD_BLOCK_COUNT,
+};
+
+enum pd_field_id_t {
+    PD_FIELD_FILE_HEADER_MAGIC,
+    PD_FIELD_FILE_HEADER_VERSION,
+    PD_FIELD_PIN_BLOCK_PIN_MAGIC,
+    PD_FIELD_PIN_BLOCK_PADDING,
+    PD_FIELD_PIN_BLOCK_PIN,
+    PD_FIELD_INFO_MAGIC,
+    PD_FIELD_INFO_BLOCK_SIZE,
+    PD_FIELD_INFO_INTENTIONALLY_NULL,
+    PD_FIELD_INFO_PRESET_VALUES,
+    PD_FIELD_INFO_FIRST_TIMESTAMP,
+    PD_FIELD_INFO_PROFILE_NAME,
+    PD_FIELD_INFO_SURNAME,
+    PD_FIELD_INFO_FIRST_NAME,
+    PD_FIELD_INFO_POSTAL_CODE,
+    PD_FIELD_INFO_PADDING_NULL,
+    PD_FIELD_INFO_STATE_OR_PREFECTURE,
+    PD_FIELD_INFO_CITY,
+    PD_FIELD_INFO_HOME_ADDRESS,
+    PD_FIELD_INFO_APARTMENT_NUMBER,
+    PD_FIELD_INFO_PHONE_NUMBER,
+    PD_FIELD_INFO_EMAIL_ADDRESS,
+    PD_FIELD_INFO_PADDING,
+    PD_FIELD_INFO_SECOND_TIMESTAMP,
+    PD_FIELD_KANA_MAGIC,
+    PD_FIELD_KANA_BLOCK_SIZE,
+    PD_FIELD_KANA_PRESET_VALUE,
+    PD_FIELD_KANA_SURNAME,
+    PD_FIELD_KANA_FIRST_NAME,
+    PD_FIELD_COUNT,
+};
+
+static constexpr pd_block_t PD_BLOCKS[] = {
+    {"file_header", 0, 5},
+    {"pin_block", 5, 123},
+    {"info", 128, 9583},
+    {"kana", 9711, 1036},
+};
+
+static constexpr pd_field_t PD_FIELDS[] = {
+    {"file_header/magic", 0, 4, PD_ENCODING_CONTENTS, "\x50\x44\x46\x46", false, 0},
+    {"file_header/version", 4, 1, PD_ENCODING_CONTENTS, "\x02", false, 0},
+    {"pin_block/pin_magic", 5, 12, PD_ENCODING_BYTES, nullptr, false, 0},
+    {"pin_block/padding", 17, 8, PD_ENCODING_BYTES, nullptr, false, 0},
+    {"pin_block/pin", 25, 8, PD_ENCODING_UTF16BE, nullptr, true, 0},
+    {"info/magic", 128, 4, PD_ENCODING_CONTENTS, "\x49\x4E\x46\x4F", false, 0},
+    {"info/block_size", 132, 4, PD_ENCODING_U4BE, nullptr, false, 0},
+    {"info/intentionally_null", 136, 4, PD_ENCODING_U4BE, nullptr, false, 0},
+    {"info/preset_values", 140, 3, PD_ENCODING_CONTENTS, "\x01\x08\x00", false, 0},
+    {"info/first_timestamp", 143, 8, PD_ENCODING_U8BE, nullptr, false, 0},
+    {"info/profile_name", 151, 56, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/surname", 207, 64, PD_ENCODING_UTF16BE, nullptr, false, 9723},
+    {"info/first_name", 271, 64, PD_ENCODING_UTF16BE, nullptr, false, 9787},
+    {"info/postal_code", 335, 34, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/padding_null", 369, 2, PD_ENCODING_U2BE, nullptr, false, 0},
+    {"info/state_or_prefecture", 371, 64, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/city", 435, 64, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/home_address", 499, 256, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/apartment_number", 755, 256, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/phone_number", 1011, 64, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/email_address", 1075, 256, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"info/padding", 1331, 1, PD_ENCODING_CONTENTS, "\x00", false, 0},
+    {"info/second_timestamp", 1332, 8, PD_ENCODING_U8BE, nullptr, false, 0},
+    {"kana/magic", 9711, 4, PD_ENCODING_CONTENTS, "\x4B\x41\x4E\x41", false, 0},
+    {"kana/block_size", 9715, 4, PD_ENCODING_U4BE, nullptr, false, 0},
+    {"kana/preset_value", 9719, 4, PD_ENCODING_CONTENTS, "\x01\x00\x00\x00", false, 0},
+    {"kana/surname", 9723, 64, PD_ENCODING_UTF16BE, nullptr, false, 0},
+    {"kana/first_name", 9787, 64, PD_ENCODING_UTF16BE, nullptr, false, 0},
+};
+
+static_assert(sizeof(PD_BLOCKS) / sizeof(*PD_BLOCKS) == PD_BLOCK_COUNT,
+              "PD_BLOCKS is out of sync with pd_block_id_t");
+static_assert(sizeof(PD_FIELDS) / sizeof(*PD_FIELDS) == PD_FIELD_COUNT,
+              "PD_FIELDS is out of sync with pd_field_id_t");
+static_assert(PD_BLOCKS[PD_BLOCK_COUNT - 1].offset + PD_BLOCKS[PD_BLOCK_COUNT - 1].length <= 0x4000,
+              "pd.dat layout exceeds the file length");
+static_assert(PD_BLOCKS[1].offset == PD_BLOCKS[0].offset + PD_BLOCKS[0].length,
+              "pin_block must follow file_header");
+static_assert(PD_BLOCKS[2].offset == PD_BLOCKS[1].offset + PD_BLOCKS[1].length,
+              "info must follow pin_block");
+static_assert(PD_BLOCKS[3].offset == PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "kana must follow info");
+static_assert(PD_FIELDS[PD_FIELD_FILE_HEADER_MAGIC].offset + PD_FIELDS[PD_FIELD_FILE_HEADER_MAGIC].length <= PD_BLOCKS[0].offset + PD_BLOCKS[0].length,
+              "file_header/magic overruns its block");
+static_assert(PD_FIELDS[PD_FIELD_FILE_HEADER_VERSION].offset + PD_FIELDS[PD_FIELD_FILE_HEADER_VERSION].length <= PD_BLOCKS[0].offset + PD_BLOCKS[0].length,
+              "file_header/version overruns its block");
+static_assert(PD_FIELDS[1].offset == PD_FIELDS[0].offset + PD_FIELDS[0].length,
+              "file_header/version must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN_MAGIC].offset + PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN_MAGIC].length <= PD_BLOCKS[1].offset + PD_BLOCKS[1].length,
+              "pin_block/pin_magic overruns its block");
+static_assert(PD_FIELDS[PD_FIELD_PIN_BLOCK_PADDING].offset + PD_FIELDS[PD_FIELD_PIN_BLOCK_PADDING].length <= PD_BLOCKS[1].offset + PD_BLOCKS[1].length,
+              "pin_block/padding overruns its block");
+static_assert(PD_FIELDS[3].offset == PD_FIELDS[2].offset + PD_FIELDS[2].length,
+              "pin_block/padding must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN].offset + PD_FIELDS[PD_FIELD_PIN_BLOCK_PIN].length <= PD_BLOCKS[1].offset + PD_BLOCKS[1].length,
+              "pin_block/pin overruns its block");
+static_assert(PD_FIELDS[4].offset == PD_FIELDS[3].offset + PD_FIELDS[3].length,
+              "pin_block/pin must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_MAGIC].offset + PD_FIELDS[PD_FIELD_INFO_MAGIC].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/magic overruns its block");
+static_assert(PD_FIELDS[PD_FIELD_INFO_BLOCK_SIZE].offset + PD_FIELDS[PD_FIELD_INFO_BLOCK_SIZE].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/block_size overruns its block");
+static_assert(PD_FIELDS[6].offset == PD_FIELDS[5].offset + PD_FIELDS[5].length,
+              "info/block_size must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_INTENTIONALLY_NULL].offset + PD_FIELDS[PD_FIELD_INFO_INTENTIONALLY_NULL].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/intentionally_null overruns its block");
+static_assert(PD_FIELDS[7].offset == PD_FIELDS[6].offset + PD_FIELDS[6].length,
+              "info/intentionally_null must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_PRESET_VALUES].offset + PD_FIELDS[PD_FIELD_INFO_PRESET_VALUES].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/preset_values overruns its block");
+static_assert(PD_FIELDS[8].offset == PD_FIELDS[7].offset + PD_FIELDS[7].length,
+              "info/preset_values must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_FIRST_TIMESTAMP].offset + PD_FIELDS[PD_FIELD_INFO_FIRST_TIMESTAMP].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/first_timestamp overruns its block");
+static_assert(PD_FIELDS[9].offset == PD_FIELDS[8].offset + PD_FIELDS[8].length,
+              "info/first_timestamp must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_PROFILE_NAME].offset + PD_FIELDS[PD_FIELD_INFO_PROFILE_NAME].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/profile_name overruns its block");
+static_assert(PD_FIELDS[10].offset == PD_FIELDS[9].offset + PD_FIELDS[9].length,
+              "info/profile_name must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_SURNAME].offset + PD_FIELDS[PD_FIELD_INFO_SURNAME].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/surname overruns its block");
+static_assert(PD_FIELDS[11].offset == PD_FIELDS[10].offset + PD_FIELDS[10].length,
+              "info/surname must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_SURNAME].kana_offset == PD_FIELDS[PD_FIELD_KANA_SURNAME].offset &&
+                  PD_FIELDS[PD_FIELD_INFO_SURNAME].length == PD_FIELDS[PD_FIELD_KANA_SURNAME].length,
+              "surname is not mirrored by KANA");
+static_assert(PD_FIELDS[PD_FIELD_INFO_FIRST_NAME].offset + PD_FIELDS[PD_FIELD_INFO_FIRST_NAME].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/first_name overruns its block");
+static_assert(PD_FIELDS[12].offset == PD_FIELDS[11].offset + PD_FIELDS[11].length,
+              "info/first_name must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_FIRST_NAME].kana_offset == PD_FIELDS[PD_FIELD_KANA_FIRST_NAME].offset &&
+                  PD_FIELDS[PD_FIELD_INFO_FIRST_NAME].length == PD_FIELDS[PD_FIELD_KANA_FIRST_NAME].length,
+              "first_name is not mirrored by KANA");
+static_assert(PD_FIELDS[PD_FIELD_INFO_POSTAL_CODE].offset + PD_FIELDS[PD_FIELD_INFO_POSTAL_CODE].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/postal_code overruns its block");
+static_assert(PD_FIELDS[13].offset == PD_FIELDS[12].offset + PD_FIELDS[12].length,
+              "info/postal_code must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_PADDING_NULL].offset + PD_FIELDS[PD_FIELD_INFO_PADDING_NULL].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/padding_null overruns its block");
+static_assert(PD_FIELDS[14].offset == PD_FIELDS[13].offset + PD_FIELDS[13].length,
+              "info/padding_null must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_STATE_OR_PREFECTURE].offset + PD_FIELDS[PD_FIELD_INFO_STATE_OR_PREFECTURE].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/state_or_prefecture overruns its block");
+static_assert(PD_FIELDS[15].offset == PD_FIELDS[14].offset + PD_FIELDS[14].length,
+              "info/state_or_prefecture must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_CITY].offset + PD_FIELDS[PD_FIELD_INFO_CITY].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/city overruns its block");
+static_assert(PD_FIELDS[16].offset == PD_FIELDS[15].offset + PD_FIELDS[15].length,
+              "info/city must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_HOME_ADDRESS].offset + PD_FIELDS[PD_FIELD_INFO_HOME_ADDRESS].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/home_address overruns its block");
+static_assert(PD_FIELDS[17].offset == PD_FIELDS[16].offset + PD_FIELDS[16].length,
+              "info/home_address must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_APARTMENT_NUMBER].offset + PD_FIELDS[PD_FIELD_INFO_APARTMENT_NUMBER].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/apartment_number overruns its block");
+static_assert(PD_FIELDS[18].offset == PD_FIELDS[17].offset + PD_FIELDS[17].length,
+              "info/apartment_number must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_PHONE_NUMBER].offset + PD_FIELDS[PD_FIELD_INFO_PHONE_NUMBER].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/phone_number overruns its block");
+static_assert(PD_FIELDS[19].offset == PD_FIELDS[18].offset + PD_FIELDS[18].length,
+              "info/phone_number must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_EMAIL_ADDRESS].offset + PD_FIELDS[PD_FIELD_INFO_EMAIL_ADDRESS].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/email_address overruns its block");
+static_assert(PD_FIELDS[20].offset == PD_FIELDS[19].offset + PD_FIELDS[19].length,
+              "info/email_address must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_PADDING].offset + PD_FIELDS[PD_FIELD_INFO_PADDING].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/padding overruns its block");
+static_assert(PD_FIELDS[21].offset == PD_FIELDS[20].offset + PD_FIELDS[20].length,
+              "info/padding must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_INFO_SECOND_TIMESTAMP].offset + PD_FIELDS[PD_FIELD_INFO_SECOND_TIMESTAMP].length <= PD_BLOCKS[2].offset + PD_BLOCKS[2].length,
+              "info/second_timestamp overruns its block");
+static_assert(PD_FIELDS[22].offset == PD_FIELDS[21].offset + PD_FIELDS[21].length,
+              "info/second_timestamp must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_KANA_MAGIC].offset + PD_FIELDS[PD_FIELD_KANA_MAGIC].length <= PD_BLOCKS[3].offset + PD_BLOCKS[3].length,
+              "kana/magic overruns its block");
+static_assert(PD_FIELDS[PD_FIELD_KANA_BLOCK_SIZE].offset + PD_FIELDS[PD_FIELD_KANA_BLOCK_SIZE].length <= PD_BLOCKS[3].offset + PD_BLOCKS[3].length,
+              "kana/block_size overruns its block");
+static_assert(PD_FIELDS[24].offset == PD_FIELDS[23].offset + PD_FIELDS[23].length,
+              "kana/block_size must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_KANA_PRESET_VALUE].offset + PD_FIELDS[PD_FIELD_KANA_PRESET_VALUE].length <= PD_BLOCKS[3].offset + PD_BLOCKS[3].length,
+              "kana/preset_value overruns its block");
+static_assert(PD_FIELDS[25].offset == PD_FIELDS[24].offset + PD_FIELDS[24].length,
+              "kana/preset_value must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_KANA_SURNAME].offset + PD_FIELDS[PD_FIELD_KANA_SURNAME].length <= PD_BLOCKS[3].offset + PD_BLOCKS[3].length,
+              "kana/surname overruns its block");
+static_assert(PD_FIELDS[26].offset == PD_FIELDS[25].offset + PD_FIELDS[25].length,
+              "kana/surname must follow its predecessor");
+static_assert(PD_FIELDS[PD_FIELD_KANA_FIRST_NAME].offset + PD_FIELDS[PD_FIELD_KANA_FIRST_NAME].length <= PD_BLOCKS[3].offset + PD_BLOCKS[3].length,
+              "kana/first_name overruns its block");
+static_assert(PD_FIELDS[27].offset == PD_FIELDS[26].offset + PD_FIELDS[26].length,
+              "kana/first_name must follow its predecessor");
@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+# Generates pd_fields.h, a constexpr table of every field's placement within
+# pd.dat, from pd.ksy. Run from this directory after editing pd.ksy:
+#
+#   python3 pd_fields.py pd.ksy > pd_fields.h
+#
+# PyYAML is required.
+
+import sys
+
+import yaml
+
+FILE_LENGTH = 0x4000
+
+# Primitive types and their sizes.
+PRIMITIVES = {
+    "u1": ("PD_ENCODING_U1", 1),
+    "u2": ("PD_ENCODING_U2BE", 2),
+    "u4": ("PD_ENCODING_U4BE", 4),
+    "u8": ("PD_ENCODING_U8BE", 8),
+}
+
+ENCODINGS = {
+    "UTF-16BE": "PD_ENCODING_UTF16BE",
+}
+
+
+def c_bytes(data):
+    return '"' + "".join("\\x%02X" % b for b in data) + '"'
+
+
+def contents_bytes(contents):
+    if isinstance(contents, str):
+        return contents.encode("ascii")
+    return bytes(contents)
+
+
+def field_layout(field):
+    """Returns (encoding, length, contents) for a single seq entry."""
+    if "contents" in field:
+        data = contents_bytes(field["contents"])
+        return "PD_ENCODING_CONTENTS", len(data), data
+
+    field_type = field.get("type")
+    if field_type in PRIMITIVES:
+        encoding, length = PRIMITIVES[field_type]
+        return encoding, length, None
+
+    length = field["size"]
+    if field_type == "str":
+        encoding = ENCODINGS.get(field["encoding"])
+        if encoding is None:
+            sys.exit("unsupported encoding %s" % field["encoding"])
+        return encoding, length, None
+
+    return "PD_ENCODING_BYTES", length, None
+
+
+def main():
+    with open(sys.argv[1]) as f:
+        ksy = yaml.safe_load(f)
+
+    blocks = []
+    fields = []
+
+    offset = 0
+    for block in ksy["seq"]:
+        size = block["size"]
+        blocks.append((block["id"], offset, size))
+
+        field_offset = offset
+        for field in ksy["types"][block["type"]]["seq"]:
+            encoding, length, contents = field_layout(field)
+            fields.append(
+                {
+                    "block": block["id"],
+                    "id": field["id"],
+                    "offset": field_offset,
+                    "length": length,
+                    "encoding": encoding,
+                    "contents": contents,
+                    "conditional": "if" in field,
+                    "kana_offset": 0,
+                }
+            )
+            field_offset += length
+
+        offset += size
+
+    if offset > FILE_LENGTH:
+        sys.exit("pd.ksy describes more than 0x%x bytes" % FILE_LENGTH)
+
+    # Strings within the INFO block are mirrored to KANA when an
+    # identically named field exists there.
+    kana = {f["id"]: f for f in fields if f["block"] == "kana"}
+    for field in fields:
+        mirror = kana.get(field["id"])
+        if (
+            field["block"] == "info"
+            and mirror is not None
+            and field["encoding"] == "PD_ENCODING_UTF16BE"
+        ):
+            field["kana_offset"] = mirror["offset"]
+
+    out = []
+    emit = out.append
+    emit("#pragma once")
+    emit("")
+    emit(
+        "// This is a generated file! Please edit source .ksy file and use "
+        "pd_fields.py to rebuild"
+    )
+    emit("")
+    emit("#include <stddef.h>")
+    emit("")
+    emit("enum pd_encoding_t {")
+    emit("    PD_ENCODING_CONTENTS,")
+    emit("    PD_ENCODING_BYTES,")
+    emit("    PD_ENCODING_U1,")
+    emit("    PD_ENCODING_U2BE,")
+    emit("    PD_ENCODING_U4BE,")
+    emit("    PD_ENCODING_U8BE,")
+    emit("    PD_ENCODING_UTF16BE,")
+    emit("};")
+    emit("")
+    emit("struct pd_block_t {")
+    emit("    const char *name;")
+    emit("    size_t offset;")
+    emit("    size_t length;")
+    emit("};")
+    emit("")
+    emit("struct pd_field_t {")
+    emit("    const char *name;")
+    emit("    size_t offset;")
+    emit("    size_t length;")
+    emit("    pd_encoding_t encoding;")
+    emit("    // Expected bytes for PD_ENCODING_CONTENTS, otherwise nullptr.")
+    emit("    const char *contents;")
+    emit("    // Whether this field is only present under a condition.")
+    emit("    bool conditional;")
+    emit("    // Offset of the KANA block's copy of this field, or 0 if none.")
+    emit("    size_t kana_offset;")
+    emit("};")
+    emit("")
+
+    emit("enum pd_block_id_t {")
+    for name, _, _ in blocks:
+        emit("    PD_BLOCK_%s," % name.upper())
+    emit("    PD_BLOCK_COUNT,")
+    emit("};")
+    emit("")
+
+    emit("enum pd_field_id_t {")
+    for field in fields:
+        emit("    PD_FIELD_%s_%s," % (field["block"].upper(), field["id"].upper()))
+    emit("    PD_FIELD_COUNT,")
+    emit("};")
+    emit("")
+
+    emit("static constexpr pd_block_t PD_BLOCKS[] = {")
+    for name, block_offset, size in blocks:
+        emit('    {"%s", %d, %d},' % (name, block_offset, size))
+    emit("};")
+    emit("")
+
+    emit("static constexpr pd_field_t PD_FIELDS[] = {")
+    for field in fields:
+        contents = field["contents"]
+        emit(
+            '    {"%s/%s", %d, %d, %s, %s, %s, %d},'
+            % (
+                field["block"],
+                field["id"],
+                field["offset"],
+                field["length"],
+                field["encoding"],
+                c_bytes(contents) if contents is not None else "nullptr",
+                "true" if field["conditional"] else "false",
+                field["kana_offset"],
+            )
+        )
+    emit("};")
+    emit("")
+
+    emit("static_assert(sizeof(PD_BLOCKS) / sizeof(*PD_BLOCKS) == PD_BLOCK_COUNT,")
+    emit('              "PD_BLOCKS is out of sync with pd_block_id_t");')
+    emit("static_assert(sizeof(PD_FIELDS) / sizeof(*PD_FIELDS) == PD_FIELD_COUNT,")
+    emit('              "PD_FIELDS is out of sync with pd_field_id_t");')
+    emit(
+        "static_assert(PD_BLOCKS[PD_BLOCK_COUNT - 1].offset + "
+        "PD_BLOCKS[PD_BLOCK_COUNT - 1].length <= 0x%x," % FILE_LENGTH
+    )
+    emit('              "pd.dat layout exceeds the file length");')
+    for i in range(1, len(blocks)):
+        emit(
+            "static_assert(PD_BLOCKS[%d].offset == PD_BLOCKS[%d].offset + "
+            "PD_BLOCKS[%d].length," % (i, i - 1, i - 1)
+        )
+        emit('              "%s must follow %s");' % (blocks[i][0], blocks[i - 1][0]))
+
+    block_index = {name: i for i, (name, _, _) in enumerate(blocks)}
+    for i, field in enumerate(fields):
+        ident = "PD_FIELD_%s_%s" % (field["block"].upper(), field["id"].upper())
+        block = "PD_BLOCKS[%d]" % block_index[field["block"]]
+        emit(
+            "static_assert(PD_FIELDS[%s].offset + PD_FIELDS[%s].length <= "
+            "%s.offset + %s.length," % (ident, ident, block, block)
+        )
+        emit('              "%s/%s overruns its block");' % (field["block"], field["id"]))
+        if i > 0 and fields[i - 1]["block"] == field["block"]:
+            emit(
+                "static_assert(PD_FIELDS[%d].offset == PD_FIELDS[%d].offset + "
+                "PD_FIELDS[%d].length," % (i, i - 1, i - 1)
+            )
+            emit('              "%s/%s must follow its predecessor");' % (field["block"], field["id"]))
+        if field["kana_offset"]:
+            mirror = "PD_FIELD_KANA_%s" % field["id"].upper()
+            emit(
+                "static_assert(PD_FIELDS[%s].kana_offset == PD_FIELDS[%s].offset &&"
+                % (ident, mirror)
+            )
+            emit(
+                "                  PD_FIELDS[%s].length == PD_FIELDS[%s].length,"
+                % (ident, mirror)
+            )
+            emit('              "%s is not mirrored by KANA");' % field["id"])
+
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+# Compiles a .lang translation into the binary catalog gettext.cpp reads in
+# place, so that nothing is parsed or copied upon loading a language. The
+# Makefile runs this for every file within data/i10n:
+#
+#   python3 langcat.py en.lang en.catalog
+#
+# A catalog is big-endian, as the Wii reads it natively. Host tests pass
+# --little-endian before the paths for catalogs their CPU reads natively.
+#
+#
+#   header   "LCAT", version, slot shift, slot count, total size (all u32)
+#   slots    slot count entries of msgid hash, msgstr offset and wide msgstr
+#            offset (all u32). Offsets are from the start of the catalog, and
+#            0 within empty slots.
+#   msgstr   expanded UTF-8 strings, each null terminated
+#   wide     the same strings widened to 32 bit wchar_t, 4 byte aligned
+#
+# Slots are placed by Fibonacci hashing of hashpjw with linear probing, and
+# never more than half are used. Messages are found by hash alone, so two
+# msgids sharing a hash are rejected here.
+
+import struct
+import sys
+
+MAGIC = 0x4C434154  # "LCAT" once stored big-endian
+VERSION = 1
+HEADER = "5I"
+SLOT = "3I"
+
+ESCAPES = {
+    ord('"'): ord('"'),
+    ord("a"): 0x07,
+    ord("b"): 0x08,
+    ord("f"): 0x0C,
+    ord("n"): 0x0A,
+    ord("r"): 0x0D,
+    ord("t"): 0x09,
+    ord("v"): 0x0B,
+}
+
+
+def hash_string(data):
+    """hashpjw, as gettext.cpp's hash_string."""
+    hval = 0
+    for c in data:
+        hval = ((hval << 4) + c) & 0xFFFFFFFF
+        g = hval & 0xF0000000
+        if g:
+            hval ^= g >> 24
+            hval ^= g
+    return hval
+
+
+def expand_escape(data):
+    """Expands escapes as gettext.cpp always has. Backslashes, octal escapes
+    and unknown escapes write nothing, and the latter keep their character."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        c = data[i]
+        i += 1
+        if c != ord("\\"):
+            out.append(c)
+            continue
+        e = data[i] if i < len(data) else 0
+        if e in ESCAPES:
+            out.append(ESCAPES[e])
+            i += 1
+        elif e == ord("\\"):
+            i += 1
+        elif ord("0") <= e <= ord("7"):
+            i += 1
+            for _ in range(2):
+                if i < len(data) and ord("0") <= data[i] <= ord("7"):
+                    i += 1
+                else:
+                    break
+    return bytes(out)
+
+
+def widen(data):
+    """Widens as charToWideChar does, decoding UTF-8 where possible."""
+    try:
+        text = data.decode("utf-8")
+    except UnicodeDecodeError:
+        return list(data)
+    return [ord(c) for c in text]
+
+
+def quoted(line, prefix):
+    """Returns the text between prefix and the last quote, if at least two
+    bytes long."""
+    if not line.startswith(prefix):
+        return None
+    text = line[len(prefix) :]
+    end = text.rfind(b'"')
+    if end <= 1:
+        return None
+    return text[:end]
+
+
+def read_messages(path):
+    """Parses a .lang file as gettext.cpp once did, returning msgid hashes
+    and msgstrs in order."""
+    with open(path, "rb") as f:
+        lines = f.read().split(b"\n")
+
+    messages = {}
+    msgids = {}
+    msgid = None
+    # A final line without a newline was never read.
+    for number, line in enumerate(lines[:-1], 1):
+        if line.startswith(b"#"):
+            continue
+
+        if line.startswith(b'msgid "'):
+            msgid = quoted(line, b'msgid "')
+        elif line.startswith(b'msgstr "'):
+            if msgid is None:
+                continue
+            msgstr = quoted(line, b'msgstr "')
+            if msgstr is not None:
+                id = hash_string(msgid)
+                other = msgids.get(id)
+                if other is not None and other != msgid:
+                    sys.exit(
+                        "%s:%d: msgid \"%s\" shares its hash with \"%s\""
+                        % (path, number, msgid.decode(), other.decode())
+                    )
+                msgids[id] = msgid
+                # As before, the last msgstr of a msgid wins.
+                messages[id] = expand_escape(msgstr)
+            msgid = None
+
+    return messages
+
+
+def main():
+    args = sys.argv[1:]
+    order = ">"
+    if args and args[0] == "--little-endian":
+        order = "<"
+        args = args[1:]
+    header = struct.Struct(order + HEADER)
+    slot = struct.Struct(order + SLOT)
+
+    messages = read_messages(args[0])
+
+    bits = 1
+    while (1 << bits) < len(messages) * 2:
+        bits += 1
+    slot_count = 1 << bits
+    shift = 32 - bits
+
+    slots = [None] * slot_count
+    for id in messages:
+        i = ((id * 2654435761) & 0xFFFFFFFF) >> shift
+        while slots[i] is not None:
+            i = (i + 1) & (slot_count - 1)
+        slots[i] = id
+
+    strings = bytearray()
+    offset = header.size + slot.size * slot_count
+    msgstr_offsets = {}
+    for id in messages:
+        msgstr_offsets[id] = offset + len(strings)
+        strings += messages[id] + b"\0"
+
+    while (offset + len(strings)) % 4:
+        strings += b"\0"
+
+    wide_offsets = {}
+    for id in messages:
+        wide_offsets[id] = offset + len(strings)
+        for c in widen(messages[id]) + [0]:
+            strings += struct.pack(order + "I", c)
+
+    size = offset + len(strings)
+    out = bytearray(header.pack(MAGIC, VERSION, shift, slot_count, size))
+    for id in slots:
+        if id is None:
+            out += slot.pack(0, 0, 0)
+        else:
+            out += slot.pack(id, msgstr_offsets[id], wide_offsets[id])
+    out += strings
+
+    with open(args[1], "wb") as f:
+        f.write(out)
+
+
+if __name__ == "__main__":
+    main()
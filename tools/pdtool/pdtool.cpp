@@ -0,0 +1,753 @@
+// pdtool decrypts, encrypts, dumps, patches and verifies pd.dat files on a
+// host, either individually or across entire directory trees.
+//
+// Results are written to stdout as one JSON object per file.
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <channel/pd_crypto.h>
+#include <channel/pd_data.h>
+#include <channel/pd_layout.h>
+#include <channel/pd_utf16.h>
+#include <channel/pd_view.h>
+#include <pd-kaitai-struct/pd.h>
+
+namespace fs = std::filesystem;
+
+enum Operation {
+    OP_DECRYPT,
+    OP_ENCRYPT,
+    OP_DUMP,
+    OP_PATCH,
+    OP_VERIFY,
+};
+
+static const char *OPERATION_NAMES[] = {"decrypt", "encrypt", "dump", "patch",
+                                        "verify"};
+static const size_t OPERATION_COUNT =
+    sizeof(OPERATION_NAMES) / sizeof(*OPERATION_NAMES);
+
+// pd.ksy describes up to the end of the KANA block.
+static const size_t LAYOUT_LENGTH =
+    PD_BLOCKS[PD_BLOCK_COUNT - 1].offset + PD_BLOCKS[PD_BLOCK_COUNT - 1].length;
+
+struct Patch {
+    const pd_field_t *field;
+    // The UTF-16BE value, already padded to the field's length.
+    std::string value;
+};
+
+struct Options {
+    Operation operation;
+    struct PDCryptoSession session;
+    // Whether input for dump and patch is already decrypted.
+    bool plain = false;
+    // Whether decrypt writes out contents that fail validation.
+    bool force = false;
+    std::string match = "pd.dat";
+    unsigned threads = 0;
+    std::vector<Patch> patches;
+    fs::path input;
+    fs::path output;
+};
+
+static Options options;
+
+static void Usage() {
+    fprintf(stderr,
+            "usage: pdtool <decrypt|encrypt|dump|patch|verify> --device-id "
+            "<hex> [options] <input> [output]\n"
+            "\n"
+            "If input is a directory, every file named --match beneath it is\n"
+            "processed, mirroring the tree beneath output.\n"
+            "\n"
+            "verify parses each file with both PDLayout and pd_t, reporting\n"
+            "any field on which they disagree. Decrypted input may be\n"
+            "truncated after the KANA block.\n"
+            "\n"
+            "  --device-id <hex>     device ID the files belong to\n"
+            "  --plain               dump, patch or verify decrypted input\n"
+            "  --force               decrypt even if the result is invalid\n"
+            "  --set <field>=<text>  patch a string field, e.g. info/city=Tokyo\n"
+            "  --match <name>        file name to look for (default pd.dat)\n"
+            "  -j <threads>          worker threads (default: all cores)\n");
+    exit(2);
+}
+
+// Unicode helpers. pd.dat stores strings as UTF-16BE, while we read and
+// write UTF-8.
+
+static void AppendUTF8(std::string &out, uint32_t c) {
+    // Unpaired surrogates cannot be represented.
+    if (c >= 0xD800 && c <= 0xDFFF) {
+        c = 0xFFFD;
+    }
+
+    if (c < 0x80) {
+        out += (char)c;
+    } else if (c < 0x800) {
+        out += (char)(0xC0 | (c >> 6));
+        out += (char)(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+        out += (char)(0xE0 | (c >> 12));
+        out += (char)(0x80 | ((c >> 6) & 0x3F));
+        out += (char)(0x80 | (c & 0x3F));
+    } else {
+        out += (char)(0xF0 | (c >> 18));
+        out += (char)(0x80 | ((c >> 12) & 0x3F));
+        out += (char)(0x80 | ((c >> 6) & 0x3F));
+        out += (char)(0x80 | (c & 0x3F));
+    }
+}
+
+// EncodeUTF16BE converts UTF-8 into a zero-padded field of length bytes.
+static bool EncodeUTF16BE(const char *text, size_t length, std::string &out) {
+    const unsigned char *p = (const unsigned char *)text;
+    std::wstring decoded;
+
+    while (*p != 0) {
+        uint32_t c;
+        int extra;
+        if (*p < 0x80) {
+            c = *p;
+            extra = 0;
+        } else if ((*p & 0xE0) == 0xC0) {
+            c = *p & 0x1F;
+            extra = 1;
+        } else if ((*p & 0xF0) == 0xE0) {
+            c = *p & 0x0F;
+            extra = 2;
+        } else if ((*p & 0xF8) == 0xF0) {
+            c = *p & 0x07;
+            extra = 3;
+        } else {
+            return false;
+        }
+        p++;
+
+        for (int i = 0; i < extra; i++, p++) {
+            if ((*p & 0xC0) != 0x80) {
+                return false;
+            }
+            c = (c << 6) | (*p & 0x3F);
+        }
+        decoded += (wchar_t)c;
+    }
+
+    out.resize(length);
+    return PD_EncodeUTF16BE(decoded.c_str(), decoded.size(),
+                            (unsigned char *)&out[0], length);
+}
+
+// ReadUTF8 converts a UTF-16BE field into UTF-8, stopping at its first null.
+static std::string ReadUTF8(const unsigned char *data,
+                            const pd_field_t &field) {
+    wchar_t decoded[PD_FILE_LENGTH / 2];
+    size_t count = PD_DecodeUTF16BE(data + field.offset, field.length,
+                                    decoded, field.length / 2);
+
+    std::string out;
+    for (size_t i = 0; i < count; i++) {
+        AppendUTF8(out, decoded[i]);
+    }
+    return out;
+}
+
+static void AppendJSONString(std::string &out, const std::string &value) {
+    out += '"';
+    for (unsigned char c : value) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (c < 0x20) {
+                char escape[8];
+                snprintf(escape, sizeof(escape), "\\u%04x", c);
+                out += escape;
+            } else {
+                out += (char)c;
+            }
+        }
+    }
+    out += '"';
+}
+
+// File handling.
+
+// ReadPD reads at least minimum bytes of a file, zeroing the remainder of
+// its 16 KiB.
+static bool ReadPD(const fs::path &path, unsigned char *buffer,
+                   size_t minimum) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == NULL) {
+        return false;
+    }
+
+    // Read one byte further to detect files which are too long.
+    size_t read = fread(buffer, 1, PD_FILE_LENGTH + 1, file);
+    fclose(file);
+    if (read < minimum || read > PD_FILE_LENGTH) {
+        return false;
+    }
+
+    memset(buffer + read, 0, PD_FILE_LENGTH - read);
+    return true;
+}
+
+static bool WritePD(const fs::path &path, const unsigned char *buffer) {
+    std::error_code error;
+    if (path.has_parent_path()) {
+        fs::create_directories(path.parent_path(), error);
+    }
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    size_t written = fwrite(buffer, 1, PD_FILE_LENGTH, file);
+    return fclose(file) == 0 && written == PD_FILE_LENGTH;
+}
+
+static void Crypt(bool encrypt, unsigned char *buffer) {
+    // Copy the session's context, as the AES functions update its IV.
+    struct AES_ctx ctx = options.session.ctx;
+    if (encrypt) {
+        AES_CBC_encrypt_buffer(&ctx, buffer, PD_FILE_LENGTH);
+    } else {
+        AES_CBC_decrypt_buffer(&ctx, buffer, PD_FILE_LENGTH);
+    }
+}
+
+// Verification compares PDLayout's record against pd_t's accessors. pdtool
+// builds the Kaitai runtime without iconv, so pd_t's strings are the raw
+// UTF-16BE bytes of each field.
+
+typedef std::vector<const char *> Mismatches;
+
+template <size_t Id>
+static void VerifyInteger(const PDRecord &record, uint64_t actual,
+                          Mismatches &mismatches) {
+    if (record.Get<Id>() != actual) {
+        mismatches.push_back(PD_FIELDS[Id].name);
+    }
+}
+
+template <size_t Id>
+static void VerifyBytes(const PDRecord &record, kaitai::bytes_span actual,
+                        Mismatches &mismatches) {
+    const auto &value = record.Get<Id>();
+    if (actual.size() != sizeof(value.bytes) ||
+        memcmp(value.bytes, actual.data(), actual.size()) != 0) {
+        mismatches.push_back(PD_FIELDS[Id].name);
+    }
+}
+
+// Contents have nothing to compare beyond both parsers accepting them.
+template <size_t Id>
+static void VerifyContents(const PDRecord &, kaitai::bytes_span actual,
+                           Mismatches &mismatches) {
+    if (actual.size() != PD_FIELDS[Id].length ||
+        memcmp(PD_FIELDS[Id].contents, actual.data(), actual.size()) != 0) {
+        mismatches.push_back(PD_FIELDS[Id].name);
+    }
+}
+
+template <size_t Id>
+static void VerifyString(const PDRecord &record, const std::string &actual,
+                         Mismatches &mismatches) {
+    const auto &value = record.Get<Id>();
+    wchar_t decoded[sizeof(value.text) / sizeof(wchar_t)] = {};
+    PD_DecodeUTF16BE((const unsigned char *)actual.data(), actual.size(),
+                     decoded, sizeof(value.text) / sizeof(wchar_t) - 1);
+    if (wcscmp(value.text, decoded) != 0) {
+        mismatches.push_back(PD_FIELDS[Id].name);
+    }
+}
+
+static void Verify(const unsigned char *buffer, Mismatches &mismatches) {
+    PDRecord record;
+    if (!PDLayout<>::Parse(buffer, record)) {
+        mismatches.push_back("layout");
+        return;
+    }
+
+    // pd_t throws on anything it rejects, which PDLayout has accepted.
+    kaitai::kstream ks(buffer, PD_FILE_LENGTH);
+    pd_t data(&ks, pd_t::PARSE_LAZY);
+    try {
+        data.file_header();
+        data.pin_block();
+        data.info();
+        data.kana();
+    } catch (const std::exception &) {
+        mismatches.push_back("pd_t");
+        return;
+    }
+
+    pd_t::header_t *header = data.file_header();
+    VerifyContents<PD_FIELD_FILE_HEADER_MAGIC>(record, header->magic(),
+                                               mismatches);
+    VerifyContents<PD_FIELD_FILE_HEADER_VERSION>(record, header->version(),
+                                                 mismatches);
+
+    pd_t::pin_block_t *pin = data.pin_block();
+    VerifyBytes<PD_FIELD_PIN_BLOCK_PIN_MAGIC>(record, pin->pin_magic(),
+                                              mismatches);
+    VerifyBytes<PD_FIELD_PIN_BLOCK_PADDING>(record, pin->padding(),
+                                            mismatches);
+    VerifyString<PD_FIELD_PIN_BLOCK_PIN>(record, pin->pin(), mismatches);
+
+    pd_t::info_block_t *info = data.info();
+    VerifyContents<PD_FIELD_INFO_MAGIC>(record, info->magic(), mismatches);
+    VerifyInteger<PD_FIELD_INFO_BLOCK_SIZE>(record, info->block_size(),
+                                            mismatches);
+    VerifyInteger<PD_FIELD_INFO_INTENTIONALLY_NULL>(
+        record, info->intentionally_null(), mismatches);
+    VerifyContents<PD_FIELD_INFO_PRESET_VALUES>(record, info->preset_values(),
+                                                mismatches);
+    VerifyInteger<PD_FIELD_INFO_FIRST_TIMESTAMP>(
+        record, info->first_timestamp(), mismatches);
+    VerifyString<PD_FIELD_INFO_PROFILE_NAME>(record, info->profile_name(),
+                                             mismatches);
+    VerifyString<PD_FIELD_INFO_SURNAME>(record, info->surname(), mismatches);
+    VerifyString<PD_FIELD_INFO_FIRST_NAME>(record, info->first_name(),
+                                           mismatches);
+    VerifyString<PD_FIELD_INFO_POSTAL_CODE>(record, info->postal_code(),
+                                            mismatches);
+    VerifyInteger<PD_FIELD_INFO_PADDING_NULL>(record, info->padding_null(),
+                                              mismatches);
+    VerifyString<PD_FIELD_INFO_STATE_OR_PREFECTURE>(
+        record, info->state_or_prefecture(), mismatches);
+    VerifyString<PD_FIELD_INFO_CITY>(record, info->city(), mismatches);
+    VerifyString<PD_FIELD_INFO_HOME_ADDRESS>(record, info->home_address(),
+                                             mismatches);
+    VerifyString<PD_FIELD_INFO_APARTMENT_NUMBER>(
+        record, info->apartment_number(), mismatches);
+    VerifyString<PD_FIELD_INFO_PHONE_NUMBER>(record, info->phone_number(),
+                                             mismatches);
+    VerifyString<PD_FIELD_INFO_EMAIL_ADDRESS>(record, info->email_address(),
+                                              mismatches);
+    VerifyContents<PD_FIELD_INFO_PADDING>(record, info->padding(),
+                                          mismatches);
+    VerifyInteger<PD_FIELD_INFO_SECOND_TIMESTAMP>(
+        record, info->second_timestamp(), mismatches);
+
+    pd_t::kana_block_t *kana = data.kana();
+    VerifyContents<PD_FIELD_KANA_MAGIC>(record, kana->magic(), mismatches);
+    VerifyInteger<PD_FIELD_KANA_BLOCK_SIZE>(record, kana->block_size(),
+                                            mismatches);
+    VerifyContents<PD_FIELD_KANA_PRESET_VALUE>(record, kana->preset_value(),
+                                               mismatches);
+    VerifyString<PD_FIELD_KANA_SURNAME>(record, kana->surname(), mismatches);
+    VerifyString<PD_FIELD_KANA_FIRST_NAME>(record, kana->first_name(),
+                                           mismatches);
+
+    // Serializing the record over the file must reproduce it exactly.
+    static thread_local unsigned char copy[PD_FILE_LENGTH];
+    memcpy(copy, buffer, PD_FILE_LENGTH);
+    if (!PDLayout<>::Serialize(record, copy) ||
+        memcmp(copy, buffer, PD_FILE_LENGTH) != 0) {
+        mismatches.push_back("serialize");
+    }
+}
+
+// ProcessFile handles a single pd.dat, returning its JSON result and
+// reporting through ok whether the operation succeeded.
+static std::string ProcessFile(const fs::path &input, const fs::path &output,
+                               bool &ok) {
+    ok = false;
+    std::string result = "{\"path\":";
+    AppendJSONString(result, input.string());
+    result += ",\"op\":\"";
+    result += OPERATION_NAMES[options.operation];
+    result += "\"";
+
+    auto fail = [&](const char *error) {
+        result += ",\"ok\":false,\"error\":";
+        AppendJSONString(result, error);
+        result += "}\n";
+        return result;
+    };
+
+    // The buffer itself is aligned for AES, and is reused by each thread.
+    alignas(32) static thread_local unsigned char buffer[PD_FILE_LENGTH + 1];
+    size_t minimum = options.operation == OP_VERIFY && options.plain
+                         ? LAYOUT_LENGTH
+                         : PD_FILE_LENGTH;
+    if (!ReadPD(input, buffer, minimum)) {
+        return fail("unable to read a 16 KiB file");
+    }
+
+    bool encrypted = options.operation != OP_ENCRYPT && !options.plain;
+    if (encrypted) {
+        Crypt(false, buffer);
+    }
+
+    PDView view(buffer);
+    bool valid = view.IsValid();
+    result += valid ? ",\"valid\":true" : ",\"valid\":false";
+
+    // Whatever we decrypt must be valid, as otherwise the device ID is
+    // most likely wrong. --force lets decrypt write it out regardless.
+    if (!valid && !(options.operation == OP_DECRYPT && options.force)) {
+        return fail("contents do not match pd.ksy");
+    }
+
+    switch (options.operation) {
+    case OP_DECRYPT:
+        break;
+
+    case OP_ENCRYPT:
+        Crypt(true, buffer);
+        break;
+
+    case OP_DUMP:
+        result += ",\"password_protected\":";
+        result += view.IsPasswordProtected() ? "true" : "false";
+        result += ",\"fields\":{";
+        for (size_t i = 0, emitted = 0; i < PD_FIELD_COUNT; i++) {
+            if (PD_FIELDS[i].encoding != PD_ENCODING_UTF16BE) {
+                continue;
+            }
+            if (emitted++ != 0) {
+                result += ',';
+            }
+            AppendJSONString(result, PD_FIELDS[i].name);
+            result += ':';
+            AppendJSONString(result, ReadUTF8(buffer, PD_FIELDS[i]));
+        }
+        result += "}";
+        break;
+
+    case OP_PATCH:
+        for (const Patch &patch : options.patches) {
+            memcpy(buffer + patch.field->offset, patch.value.data(),
+                   patch.field->length);
+
+            // Names are additionally present within the KANA block.
+            if (patch.field->kana_offset != 0) {
+                memcpy(buffer + patch.field->kana_offset, patch.value.data(),
+                       patch.field->length);
+            }
+        }
+        if (encrypted) {
+            Crypt(true, buffer);
+        }
+        break;
+
+    case OP_VERIFY: {
+        Mismatches mismatches;
+        Verify(buffer, mismatches);
+        result += ",\"mismatches\":[";
+        for (size_t i = 0; i < mismatches.size(); i++) {
+            if (i != 0) {
+                result += ',';
+            }
+            AppendJSONString(result, mismatches[i]);
+        }
+        result += "]";
+        if (!mismatches.empty()) {
+            return fail("verification failed");
+        }
+        break;
+    }
+    }
+
+    bool writes = options.operation != OP_DUMP && options.operation != OP_VERIFY;
+    if (writes && !WritePD(output, buffer)) {
+        return fail("unable to write output");
+    }
+
+    result += ",\"ok\":true}\n";
+    ok = true;
+    return result;
+}
+
+// Work-stealing thread pool. Each worker owns a deque of jobs, taking from
+// its back and stealing from the front of others' when it runs dry.
+// Directories are jobs themselves, so that walking large trees is shared.
+// Idle workers sleep until a job is queued or every job has completed.
+
+struct Job {
+    fs::path input;
+    fs::path output;
+    bool directory;
+};
+
+struct WorkerQueue {
+    std::mutex lock;
+    std::deque<Job> jobs;
+};
+
+static std::vector<WorkerQueue> queues;
+static std::atomic<size_t> pendingJobs(0);
+static std::atomic<size_t> queuedJobs(0);
+static std::mutex idleLock;
+static std::condition_variable idleWake;
+static std::atomic<size_t> processedFiles(0);
+static std::atomic<size_t> failedFiles(0);
+static std::mutex outputLock;
+
+static void PushJob(unsigned worker, Job job) {
+    // Count the job before publishing it, so that whoever takes it never
+    // decrements queuedJobs below zero.
+    pendingJobs++;
+    queuedJobs++;
+    {
+        std::lock_guard<std::mutex> guard(queues[worker].lock);
+        queues[worker].jobs.push_back(std::move(job));
+    }
+
+    std::lock_guard<std::mutex> guard(idleLock);
+    idleWake.notify_one();
+}
+
+static void FinishJob() {
+    if (--pendingJobs == 0) {
+        std::lock_guard<std::mutex> guard(idleLock);
+        idleWake.notify_all();
+    }
+}
+
+static bool TakeJob(unsigned worker, Job &job) {
+    {
+        WorkerQueue &own = queues[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            queuedJobs--;
+            return true;
+        }
+    }
+
+    for (size_t i = 1; i < queues.size(); i++) {
+        WorkerQueue &victim = queues[(worker + i) % queues.size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            queuedJobs--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void Emit(const std::string &line) {
+    std::lock_guard<std::mutex> guard(outputLock);
+    fwrite(line.data(), 1, line.size(), stdout);
+}
+
+static void RunJob(unsigned worker, const Job &job) {
+    if (!job.directory) {
+        bool ok;
+        std::string line = ProcessFile(job.input, job.output, ok);
+        processedFiles++;
+        if (!ok) {
+            failedFiles++;
+        }
+        Emit(line);
+        return;
+    }
+
+    std::error_code error;
+    for (fs::directory_iterator it(job.input, error), end; it != end;
+         it.increment(error)) {
+        const fs::directory_entry &entry = *it;
+        fs::path output = job.output / entry.path().filename();
+
+        if (entry.is_directory(error)) {
+            PushJob(worker, {entry.path(), output, true});
+        } else if (entry.path().filename() == options.match) {
+            PushJob(worker, {entry.path(), output, false});
+        }
+    }
+
+    if (error) {
+        std::string line = "{\"path\":";
+        AppendJSONString(line, job.input.string());
+        line += ",\"ok\":false,\"error\":";
+        AppendJSONString(line, error.message());
+        line += "}\n";
+        Emit(line);
+    }
+}
+
+static void Worker(unsigned worker) {
+    Job job;
+    for (;;) {
+        if (TakeJob(worker, job)) {
+            RunJob(worker, job);
+            FinishJob();
+            continue;
+        }
+
+        // Another worker may take the job we were woken for, in which case
+        // we look again. Only once every job has completed are we done.
+        std::unique_lock<std::mutex> guard(idleLock);
+        idleWake.wait(guard, [] {
+            return queuedJobs.load() != 0 || pendingJobs.load() == 0;
+        });
+        if (pendingJobs.load() == 0) {
+            return;
+        }
+    }
+}
+
+static const pd_field_t *FindField(const char *name, size_t length) {
+    for (size_t i = 0; i < PD_FIELD_COUNT; i++) {
+        if (strlen(PD_FIELDS[i].name) == length &&
+            strncmp(PD_FIELDS[i].name, name, length) == 0) {
+            return &PD_FIELDS[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void ParseArguments(int argc, char **argv) {
+    if (argc < 2) {
+        Usage();
+    }
+
+    bool found = false;
+    for (size_t i = 0; i < OPERATION_COUNT; i++) {
+        if (strcmp(argv[1], OPERATION_NAMES[i]) == 0) {
+            options.operation = (Operation)i;
+            found = true;
+        }
+    }
+    if (!found) {
+        Usage();
+    }
+
+    bool haveDeviceId = false;
+    std::vector<const char *> positional;
+    for (int i = 2; i < argc; i++) {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(arg, "--device-id") == 0 && hasValue) {
+            char *end;
+            unsigned long deviceId = strtoul(argv[++i], &end, 16);
+            if (*end != 0) {
+                fprintf(stderr, "Invalid device ID %s\n", argv[i]);
+                exit(2);
+            }
+            PD_InitCryptoSession(&options.session, (uint32_t)deviceId);
+            haveDeviceId = true;
+        } else if (strcmp(arg, "--plain") == 0) {
+            options.plain = true;
+        } else if (strcmp(arg, "--force") == 0) {
+            options.force = true;
+        } else if (strcmp(arg, "--match") == 0 && hasValue) {
+            options.match = argv[++i];
+        } else if (strcmp(arg, "-j") == 0 && hasValue) {
+            options.threads = atoi(argv[++i]);
+        } else if (strcmp(arg, "--set") == 0 && hasValue) {
+            const char *assignment = argv[++i];
+            const char *equals = strchr(assignment, '=');
+            const pd_field_t *field =
+                equals ? FindField(assignment, equals - assignment) : NULL;
+            if (field == NULL || field->encoding != PD_ENCODING_UTF16BE) {
+                fprintf(stderr, "%s does not name a string field\n",
+                        assignment);
+                exit(2);
+            }
+
+            Patch patch = {field, ""};
+            if (!EncodeUTF16BE(equals + 1, field->length, patch.value)) {
+                fprintf(stderr, "%s is invalid or too long for %s\n",
+                        equals + 1, field->name);
+                exit(2);
+            }
+            options.patches.push_back(patch);
+        } else if (arg[0] == '-') {
+            Usage();
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    bool needsOutput =
+        options.operation != OP_DUMP && options.operation != OP_VERIFY;
+    if (positional.size() != (needsOutput ? 2u : 1u)) {
+        Usage();
+    }
+    options.input = positional[0];
+    if (needsOutput) {
+        options.output = positional[1];
+    }
+
+    bool needsDeviceId = !(options.plain && options.operation != OP_ENCRYPT);
+    if (needsDeviceId && !haveDeviceId) {
+        fprintf(stderr, "--device-id is required\n");
+        exit(2);
+    }
+    if (options.operation == OP_PATCH && options.patches.empty()) {
+        fprintf(stderr, "patch requires at least one --set\n");
+        exit(2);
+    }
+
+    if (options.threads == 0) {
+        options.threads = std::thread::hardware_concurrency();
+        if (options.threads == 0) {
+            options.threads = 1;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    ParseArguments(argc, argv);
+
+    std::error_code error;
+    bool directory = fs::is_directory(options.input, error);
+
+    queues = std::vector<WorkerQueue>(options.threads);
+    PushJob(0, {options.input, options.output, directory});
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < options.threads; i++) {
+        workers.emplace_back(Worker, i);
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    fprintf(stderr, "%zu files, %zu failed, %.3f s (%.0f files/s)\n",
+            processedFiles.load(), failedFiles.load(), seconds,
+            seconds > 0 ? processedFiles.load() / seconds : 0.0);
+
+    return failedFiles.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// BenchNanoseconds reads a monotonic clock.
+static inline uint64_t BenchNanoseconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+// BenchCycles reads the timestamp counter where there is one, and 0
+// otherwise, in which case only times are reported.
+static inline uint64_t BenchCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// BenchDoNotOptimize keeps the compiler from discarding a result.
+static inline void BenchDoNotOptimize(const void *p) {
+    __asm__ volatile("" : : "g"(p) : "memory");
+}
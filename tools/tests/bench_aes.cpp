@@ -0,0 +1,61 @@
+// Cycles per byte of CBC over a 16 KiB pd.dat, per AES backend.
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+
+extern "C" {
+#include <aes/aes.h>
+}
+
+#define BENCH_LENGTH 0x4000
+#define BENCH_ROUNDS 200
+
+static uint8_t Buffer[BENCH_LENGTH];
+static uint8_t Plain[BENCH_LENGTH];
+
+static void Run(const char *name, enum AES_backend backend, bool encrypt) {
+    const uint8_t key[AES_KEYLEN] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const uint8_t iv[AES_BLOCKLEN] = {9, 10, 11, 12};
+    struct AES_ctx ctx;
+    AES_init_ctx_iv_backend(&ctx, key, iv, backend);
+
+    uint64_t start = BenchNanoseconds(), startCycles = BenchCycles();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        AES_ctx_set_iv(&ctx, iv);
+        if (encrypt) {
+            AES_CBC_encrypt_buffer(&ctx, Buffer, BENCH_LENGTH);
+        } else {
+            AES_CBC_decrypt_buffer(&ctx, Buffer, BENCH_LENGTH);
+        }
+        BenchDoNotOptimize(Buffer);
+    }
+    uint64_t cycles = BenchCycles() - startCycles;
+    uint64_t nanoseconds = BenchNanoseconds() - start;
+
+    double bytes = (double)BENCH_LENGTH * BENCH_ROUNDS;
+    printf("%-9s %-7s %6.2f ns/byte %7.2f cycles/byte\n", name,
+           encrypt ? "encrypt" : "decrypt", nanoseconds / bytes,
+           cycles / bytes);
+}
+
+int main() {
+    for (int i = 0; i < BENCH_LENGTH; i++) {
+        Plain[i] = (uint8_t)(i * 31);
+    }
+
+    struct {
+        const char *name;
+        enum AES_backend backend;
+    } backends[] = {
+        {"reference", AES_BACKEND_REFERENCE},
+        {"ttable", AES_BACKEND_TTABLE},
+    };
+
+    for (auto &backend : backends) {
+        memcpy(Buffer, Plain, BENCH_LENGTH);
+        Run(backend.name, backend.backend, true);
+        Run(backend.name, backend.backend, false);
+    }
+    return 0;
+}
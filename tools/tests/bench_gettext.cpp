@@ -0,0 +1,78 @@
+// Nanoseconds per LoadLanguage and per lookup, for every catalog within
+// data/i10n. Lookups cover each msgid of the catalog, then as many misses.
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+
+#include <catalogs.h>
+#include <gccore.h>
+#include <gui/gettext.h>
+
+#define LOAD_ROUNDS 100000
+#define LOOKUP_ROUNDS 20000
+
+// Only reached by text_language, which is not measured.
+s32 CONF_GetLanguage(void) { return CONF_LANG_ENGLISH; }
+
+// Reads the msgids of a .lang file, as langcat.py does.
+static std::vector<std::string> ReadMsgids(const char *language) {
+    std::string path =
+        std::string(SOURCE_DIR "/../data/i10n/") + language + ".lang";
+    std::vector<std::string> msgids;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == NULL) {
+        return msgids;
+    }
+
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        const char *prefix = "msgid \"";
+        char *end = strrchr(line, '"');
+        if (strncmp(line, prefix, strlen(prefix)) == 0 &&
+            end > line + strlen(prefix)) {
+            msgids.push_back(std::string(line + strlen(prefix), end));
+        }
+    }
+    fclose(f);
+    return msgids;
+}
+
+static void Run(const char *language, const u8 *catalog, u32 size) {
+    std::vector<std::string> msgids = ReadMsgids(language);
+    std::vector<std::string> misses;
+    for (const std::string &msgid : msgids) {
+        misses.push_back(msgid + " (untranslated)");
+    }
+
+    uint64_t start = BenchNanoseconds();
+    for (int i = 0; i < LOAD_ROUNDS; i++) {
+        LoadLanguage((char *)catalog, size);
+    }
+    double load = (double)(BenchNanoseconds() - start) / LOAD_ROUNDS;
+
+    double lookups[2];
+    const std::vector<std::string> *sets[2] = {&msgids, &misses};
+    for (int set = 0; set < 2; set++) {
+        start = BenchNanoseconds();
+        for (int i = 0; i < LOOKUP_ROUNDS; i++) {
+            for (const std::string &msgid : *sets[set]) {
+                BenchDoNotOptimize(gettext(msgid.c_str()));
+            }
+        }
+        lookups[set] = (double)(BenchNanoseconds() - start) /
+                       (LOOKUP_ROUNDS * sets[set]->size());
+    }
+
+    printf("%s: %zu msgids, load %6.1f ns, hit %5.1f ns, miss %5.1f ns\n",
+           language, msgids.size(), load, lookups[0], lookups[1]);
+}
+
+int main() {
+#define CATALOG(name) Run(#name, name##_lang, name##_lang_size);
+    CATALOGS
+#undef CATALOG
+    return 0;
+}
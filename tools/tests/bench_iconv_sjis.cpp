@@ -0,0 +1,80 @@
+// Milliseconds to convert a synthetic corpus of Japanese names, kana
+// readings and addresses, as the KANA and INFO blocks hold, from UTF-8 to
+// Shift_JIS through iconv.
+#include <musl/iconv.h>
+#include <random>
+#include <stdio.h>
+#include <string>
+
+#include "bench.h"
+
+#define CORPUS_ENTRIES 20000
+#define BENCH_ROUNDS 20
+
+static const char *const Surnames[] = {
+    u8"佐藤", u8"鈴木", u8"高橋", u8"田中", u8"伊藤", u8"渡辺",
+    u8"山本", u8"中村", u8"小林", u8"加藤", u8"吉田", u8"山田",
+};
+static const char *const FirstNames[] = {
+    u8"翔太", u8"陽菜", u8"大輔", u8"美咲", u8"健一", u8"さくら",
+    u8"拓海", u8"結衣", u8"蓮",   u8"葵",   u8"悠真", u8"由美子",
+};
+static const char *const Readings[] = {
+    u8"サトウ",   u8"スズキ", u8"タカハシ", u8"タナカ", u8"イトウ",
+    u8"ワタナベ", u8"ショウタ", u8"ヒナ",  u8"ダイスケ", u8"ミサキ",
+};
+static const char *const Prefectures[] = {
+    u8"東京都", u8"大阪府", u8"北海道", u8"京都府", u8"神奈川県", u8"福岡県",
+};
+static const char *const Cities[] = {
+    u8"千代田区丸の内", u8"中央区難波", u8"札幌市北区", u8"左京区吉田",
+    u8"横浜市西区",     u8"博多区博多駅前",
+};
+
+template <size_t N>
+static const char *Pick(std::mt19937 &random, const char *const (&list)[N]) {
+    return list[random() % N];
+}
+
+int main() {
+    std::mt19937 random(20);
+    std::string corpus;
+    for (int i = 0; i < CORPUS_ENTRIES; i++) {
+        corpus += Pick(random, Surnames);
+        corpus += u8"　";
+        corpus += Pick(random, FirstNames);
+        corpus += Pick(random, Readings);
+        corpus += Pick(random, Prefectures);
+        corpus += Pick(random, Cities);
+        corpus += std::to_string(random() % 9 + 1) + u8"丁目" +
+                  std::to_string(random() % 30 + 1) + u8"番地\n";
+    }
+
+    iconv_t cd = iconv_open_r("SHIFT_JIS", "UTF-8", NULL);
+    if (cd == (iconv_t)-1) {
+        printf("Unable to open UTF-8 to Shift_JIS\n");
+        return 1;
+    }
+
+    std::string output(corpus.size(), 0);
+    size_t written = 0;
+    uint64_t start = BenchNanoseconds();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        char *in = &corpus[0], *out = &output[0];
+        size_t inLength = corpus.size(), outLength = output.size();
+        int error = 0;
+        if (iconv_r(cd, &in, &inLength, &out, &outLength, &error) != 0) {
+            printf("Conversion failed with %d\n", error);
+            return 1;
+        }
+        written = output.size() - outLength;
+        BenchDoNotOptimize(output.data());
+    }
+    double milliseconds = (BenchNanoseconds() - start) / 1e6 / BENCH_ROUNDS;
+
+    printf("%zu KB UTF-8 -> %zu KB Shift_JIS: %.2f ms (%.1f MB/s)\n",
+           corpus.size() / 1024, written / 1024, milliseconds,
+           corpus.size() / milliseconds / 1000);
+    iconv_close(cd);
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Conversions per second of short Shift_JIS names to UTF-8, as pd.dat's
+// KANA block holds, from 1, 2, 4 and 8 threads sharing one descriptor.
+// Each thread converts the same number of names, so ideal scaling keeps
+// the per-thread rate constant until threads outnumber cores.
+#include <musl/iconv.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+
+#define CONVERSIONS 200000
+#define MAX_THREADS 8
+
+static const char *const Names[] = {
+    u8"サトウ　ショウタ", u8"スズキ　ヒナ",     u8"タカハシ　ダイスケ",
+    u8"タナカ　ミサキ",   u8"イトウ　ケンイチ", u8"ワタナベ　サクラ",
+    u8"佐藤　翔太",       u8"鈴木　陽菜",       u8"高橋　大輔",
+};
+#define NAME_COUNT (sizeof(Names) / sizeof(*Names))
+
+// Convert converts every name in turn, returning the number of failures.
+static int Convert(iconv_t cd, const std::vector<std::string> &names) {
+    int failures = 0;
+    char output[64];
+    for (int i = 0; i < CONVERSIONS; i++) {
+        const std::string &name = names[i % names.size()];
+        char *in = (char *)name.data(), *out = output;
+        size_t inLength = name.size(), outLength = sizeof(output);
+        int error = 0;
+        if (iconv_r(cd, &in, &inLength, &out, &outLength, &error) != 0) {
+            failures++;
+        }
+        BenchDoNotOptimize(output);
+    }
+    return failures;
+}
+
+int main() {
+    // Prepare the names as Shift_JIS, as they would be read.
+    iconv_t encode = iconv_open_r("SHIFT_JIS", "UTF-8", NULL);
+    iconv_t cd = iconv_open_r("UTF-8", "SHIFT_JIS", NULL);
+    if (encode == (iconv_t)-1 || cd == (iconv_t)-1) {
+        printf("Unable to open Shift_JIS\n");
+        return 1;
+    }
+    std::vector<std::string> names;
+    for (size_t i = 0; i < NAME_COUNT; i++) {
+        std::string input = Names[i], output(64, 0);
+        char *in = &input[0], *out = &output[0];
+        size_t inLength = input.size(), outLength = output.size();
+        if (iconv_r(encode, &in, &inLength, &out, &outLength, NULL) != 0) {
+            printf("Unable to encode %s\n", Names[i]);
+            return 1;
+        }
+        output.resize(output.size() - outLength);
+        names.push_back(output);
+    }
+    iconv_close(encode);
+
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    double single = 0;
+    for (int count = 1; count <= MAX_THREADS; count *= 2) {
+        std::vector<std::thread> threads;
+        std::vector<int> failures(count);
+        uint64_t start = BenchNanoseconds();
+        for (int t = 0; t < count; t++) {
+            threads.emplace_back([&, t] { failures[t] = Convert(cd, names); });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        double seconds = (BenchNanoseconds() - start) / 1e9;
+
+        for (int t = 0; t < count; t++) {
+            if (failures[t] != 0) {
+                printf("%d conversions failed\n", failures[t]);
+                return 1;
+            }
+        }
+        double rate = (double)count * CONVERSIONS / seconds;
+        if (count == 1) {
+            single = rate;
+        }
+        printf("%d threads: %10.0f conversions/s (%.2fx)\n", count, rate,
+               rate / single);
+    }
+
+    iconv_close(cd);
+    return 0;
+}
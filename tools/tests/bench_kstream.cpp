@@ -0,0 +1,67 @@
+// Microseconds per pd_t parse of the bundled pd.dat, and nanoseconds per
+// read_u4be, for std::istream-backed and memory-backed streams.
+#include <kaitai/kaitaistream.h>
+#include <pd-kaitai-struct/pd.h>
+#include <sstream>
+#include <stdio.h>
+
+#include "bench.h"
+#include "nand.h"
+
+#include <channel/pd_data.h>
+#include <pd_decrypted_dat.h>
+
+#define PARSE_ROUNDS 20000
+#define READ_ROUNDS 200
+
+static void BenchParse(const char *name, bool memory) {
+    uint64_t start = BenchNanoseconds();
+    for (int i = 0; i < PARSE_ROUNDS; i++) {
+        if (memory) {
+            kaitai::kstream ks(pd_decrypted_dat, PD_FILE_LENGTH);
+            pd_t pd(&ks);
+            BenchDoNotOptimize(&pd);
+        } else {
+            std::istringstream is(std::string(
+                (const char *)pd_decrypted_dat, PD_FILE_LENGTH));
+            kaitai::kstream ks(&is);
+            pd_t pd(&ks);
+            BenchDoNotOptimize(&pd);
+        }
+    }
+    printf("%-8s parse   %7.2f us/parse\n", name,
+           (BenchNanoseconds() - start) / 1000.0 / PARSE_ROUNDS);
+}
+
+static void BenchRead(const char *name, kaitai::kstream &ks) {
+    uint32_t sum = 0;
+    uint64_t start = BenchNanoseconds();
+    for (int i = 0; i < READ_ROUNDS; i++) {
+        ks.seek(0);
+        while (ks.pos() < ks.size()) {
+            sum += ks.read_u4be();
+        }
+    }
+    BenchDoNotOptimize(&sum);
+    printf("%-8s u4be    %7.2f ns/read\n", name,
+           (double)(BenchNanoseconds() - start) /
+               (READ_ROUNDS * (PD_FILE_LENGTH / 4)));
+}
+
+int main() {
+    if (!NAND_LoadTemplate()) {
+        printf("Unable to read pd_decrypted.dat\n");
+        return 1;
+    }
+
+    BenchParse("istream", false);
+    BenchParse("memory", true);
+
+    std::istringstream is(
+        std::string((const char *)pd_decrypted_dat, PD_FILE_LENGTH));
+    kaitai::kstream istream(&is);
+    kaitai::kstream memory(pd_decrypted_dat, PD_FILE_LENGTH);
+    BenchRead("istream", istream);
+    BenchRead("memory", memory);
+    return 0;
+}
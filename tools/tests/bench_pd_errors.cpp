@@ -0,0 +1,82 @@
+// Microseconds per pd_t parse of the bundled pd.dat and of copies
+// corrupted in each block. Built twice: once throwing on failure, and
+// once with KS_NO_EXCEPTIONS, recording failures to pd_t::_status().
+#include <exception>
+#include <kaitai/kaitaistream.h>
+#include <pd-kaitai-struct/pd.h>
+#include <pd-kaitai-struct/pd_fields.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "nand.h"
+
+#include <channel/pd_data.h>
+#include <pd_decrypted_dat.h>
+
+#define BENCH_ROUNDS 20000
+
+static unsigned char Corrupt[PD_FILE_LENGTH];
+
+// Parse returns where parsing failed, or NULL on success.
+static const char *Parse(const unsigned char *buffer) {
+#ifdef KS_NO_EXCEPTIONS
+    kaitai::kstream ks(buffer, PD_FILE_LENGTH);
+    pd_t pd(&ks);
+    return pd._status().ok() ? NULL : pd._status().path();
+#else
+    try {
+        kaitai::kstream ks(buffer, PD_FILE_LENGTH);
+        pd_t pd(&ks);
+    } catch (const std::exception &e) {
+        return "(thrown)";
+    }
+    return NULL;
+#endif
+}
+
+static void Run(const char *name, const unsigned char *buffer) {
+    const char *failure = NULL;
+    uint64_t start = BenchNanoseconds();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        failure = Parse(buffer);
+        BenchDoNotOptimize(failure);
+    }
+    printf("%-10s %7.2f us/parse  %s\n", name,
+           (BenchNanoseconds() - start) / 1000.0 / BENCH_ROUNDS,
+           failure ? failure : "ok");
+}
+
+int main() {
+    if (!NAND_LoadTemplate()) {
+        printf("Unable to read pd_decrypted.dat\n");
+        return 1;
+    }
+
+#ifdef KS_NO_EXCEPTIONS
+    printf("KS_NO_EXCEPTIONS\n");
+#endif
+    Run("valid", pd_decrypted_dat);
+
+    // Each overwrites the start of a field. A lone low surrogate cannot be
+    // converted to UTF-8.
+    struct {
+        const char *name;
+        pd_field_id_t field;
+        const char *value;
+        size_t length;
+    } corruptions[] = {
+        {"header", PD_FIELD_FILE_HEADER_MAGIC, "X", 1},
+        {"preset", PD_FIELD_INFO_PRESET_VALUES, "\x7f", 1},
+        {"surrogate", PD_FIELD_INFO_SURNAME, "\xDC\x00", 2},
+        {"kana", PD_FIELD_KANA_PRESET_VALUE, "\x09", 1},
+    };
+
+    for (auto &corruption : corruptions) {
+        memcpy(Corrupt, pd_decrypted_dat, PD_FILE_LENGTH);
+        memcpy(Corrupt + PD_FIELDS[corruption.field].offset, corruption.value,
+               corruption.length);
+        Run(corruption.name, Corrupt);
+    }
+    return 0;
+}
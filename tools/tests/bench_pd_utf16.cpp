@@ -0,0 +1,69 @@
+// Nanoseconds per pd.dat string field, transcoding through the codecvt
+// pipelines that PD_DecodeUTF16BE and PD_EncodeUTF16BE replaced.
+#include <codecvt>
+#include <locale>
+#include <stdio.h>
+#include <string>
+
+#include "bench.h"
+
+#include <channel/pd_utf16.h>
+
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+#define FIELD_LENGTH 64
+#define BENCH_ROUNDS 200000
+
+typedef std::wstring_convert<std::codecvt_utf16<wchar_t>, wchar_t> Convert;
+
+static const wchar_t Input[] = L"Dolphin Emulator \x65E5\x672C\x8A9E \x1F600";
+static unsigned char Field[FIELD_LENGTH];
+static wchar_t Output[FIELD_LENGTH / 2];
+
+static void Report(const char *name, uint64_t start) {
+    printf("%-15s %7.1f ns/field\n", name,
+           (double)(BenchNanoseconds() - start) / BENCH_ROUNDS);
+}
+
+int main() {
+    PD_EncodeUTF16BE(Input, FIELD_LENGTH, Field, FIELD_LENGTH);
+
+    // Both legacy directions allocated the result on the heap.
+    uint64_t start = BenchNanoseconds();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        std::string *value = new std::string(Convert().to_bytes(Input));
+        value->resize(FIELD_LENGTH);
+        BenchDoNotOptimize(value->data());
+        delete value;
+    }
+    Report("codecvt encode", start);
+
+    start = BenchNanoseconds();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        PD_EncodeUTF16BE(Input, FIELD_LENGTH, Field, FIELD_LENGTH);
+        BenchDoNotOptimize(Field);
+    }
+    Report("direct encode", start);
+
+    start = BenchNanoseconds();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        size_t units = 0;
+        while (units < FIELD_LENGTH / 2 &&
+               (Field[units * 2] | Field[units * 2 + 1])) {
+            units++;
+        }
+        std::wstring *value = new std::wstring(Convert().from_bytes(
+            (const char *)Field, (const char *)Field + units * 2));
+        BenchDoNotOptimize(value->data());
+        delete value;
+    }
+    Report("codecvt decode", start);
+
+    start = BenchNanoseconds();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        PD_DecodeUTF16BE(Field, FIELD_LENGTH, Output, FIELD_LENGTH / 2);
+        BenchDoNotOptimize(Output);
+    }
+    Report("direct decode", start);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# Emits a file as C source defining it as bin2o would, so that host builds
+# can link data the Wii build embeds:
+#
+#   python3 bin2c.py en.lang en_lang > en_lang.c
+
+import sys
+
+
+def main():
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+    name = sys.argv[2]
+
+    out = ["/* Generated by bin2c.py from %s */" % sys.argv[1]]
+    out.append("#include <gctypes.h>")
+    out.append("")
+    out.append("const u8 %s[] __attribute__((aligned(32))) = {" % name)
+    for i in range(0, len(data), 16):
+        out.append("    " + " ".join("%d," % b for b in data[i : i + 16]))
+    out.append("};")
+    out.append("const u32 %s_size = sizeof(%s);" % (name, name))
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
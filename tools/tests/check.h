@@ -0,0 +1,17 @@
+#pragma once
+#include <stdio.h>
+
+// CHECK reports a failed condition and carries on, so that one run lists
+// every failure. Tests return CHECK_RESULT from main.
+static int CheckFailures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__,            \
+                   #condition);                                                \
+            CheckFailures++;                                                   \
+        }                                                                      \
+    } while (0)
+
+#define CHECK_RESULT (CheckFailures == 0 ? 0 : 1)
@@ -0,0 +1,149 @@
+// An in-memory NAND, so that pd_data.cpp can be tested on the host.
+#include <gccore.h>
+#include <map>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "nand.h"
+#include "pd_decrypted_dat.h"
+
+#include <channel/pd_data.h>
+
+extern "C" {
+#include <channel/helpers.h>
+#include <channel/region.h>
+}
+
+u8 pd_decrypted_dat[PD_FILE_LENGTH];
+const u32 pd_decrypted_dat_size = PD_FILE_LENGTH;
+
+struct NANDHandle {
+    std::string path;
+    size_t position;
+};
+
+static std::map<std::string, std::vector<uint8_t>> NANDFiles;
+static std::map<s32, NANDHandle> NANDHandles;
+static s32 NANDNextFd = 3;
+static int64_t NANDWriteBudget = -1;
+
+void NAND_SetFile(const char *path, const std::vector<uint8_t> &contents) {
+    NANDFiles[path] = contents;
+}
+
+bool NAND_GetFile(const char *path, std::vector<uint8_t> &contents) {
+    auto file = NANDFiles.find(path);
+    if (file == NANDFiles.end()) {
+        return false;
+    }
+    contents = file->second;
+    return true;
+}
+
+void NAND_FailWritesAfter(int64_t bytes) { NANDWriteBudget = bytes; }
+
+bool NAND_LoadTemplate() {
+    FILE *f = fopen(SOURCE_DIR "/../data/title/pd_decrypted.dat", "rb");
+    if (f == NULL) {
+        return false;
+    }
+    // The fixture is a block short of PD_FILE_LENGTH; the rest stays zero.
+    size_t read = fread(pd_decrypted_dat, 1, PD_FILE_LENGTH, f);
+    fclose(f);
+    return read != 0;
+}
+
+s32 ES_GetDeviceID(u32 *deviceId) {
+    *deviceId = NAND_DEVICE_ID;
+    return 0;
+}
+
+s32 ISFS_Open(const char *path, u8 mode) {
+    (void)mode;
+    if (NANDFiles.find(path) == NANDFiles.end()) {
+        return -106;
+    }
+    NANDHandles[NANDNextFd] = {path, 0};
+    return NANDNextFd++;
+}
+
+s32 ISFS_Close(s32 fd) { return NANDHandles.erase(fd) ? 0 : -101; }
+
+s32 ISFS_Read(s32 fd, void *buffer, u32 length) {
+    auto handle = NANDHandles.find(fd);
+    if (handle == NANDHandles.end()) {
+        return -101;
+    }
+
+    std::vector<uint8_t> &file = NANDFiles[handle->second.path];
+    size_t position = handle->second.position;
+    size_t count = position < file.size() ? file.size() - position : 0;
+    if (count > length) {
+        count = length;
+    }
+    memcpy(buffer, file.data() + position, count);
+    handle->second.position += count;
+    return count;
+}
+
+s32 ISFS_Write(s32 fd, const void *buffer, u32 length) {
+    auto handle = NANDHandles.find(fd);
+    if (handle == NANDHandles.end()) {
+        return -101;
+    }
+
+    // A failing write may still have written part of its data.
+    u32 count = length;
+    bool fail = NANDWriteBudget >= 0 && NANDWriteBudget < length;
+    if (fail) {
+        count = NANDWriteBudget;
+    }
+    if (NANDWriteBudget >= 0) {
+        NANDWriteBudget -= count;
+    }
+
+    std::vector<uint8_t> &file = NANDFiles[handle->second.path];
+    size_t position = handle->second.position;
+    if (file.size() < position + count) {
+        file.resize(position + count);
+    }
+    memcpy(file.data() + position, buffer, count);
+    handle->second.position += count;
+    return fail ? -1 : (s32)count;
+}
+
+s32 ISFS_Seek(s32 fd, s32 where, s32 whence) {
+    auto handle = NANDHandles.find(fd);
+    if (handle == NANDHandles.end() || whence != SEEK_SET) {
+        return -101;
+    }
+    handle->second.position = where;
+    return where;
+}
+
+s32 ISFS_Delete(const char *path) { return NANDFiles.erase(path) ? 0 : -106; }
+
+s32 ISFS_CreateFile(const char *path, u8 attributes, u8 ownerPerm,
+                    u8 groupPerm, u8 otherPerm) {
+    (void)attributes;
+    (void)ownerPerm;
+    (void)groupPerm;
+    (void)otherPerm;
+    if (NANDFiles.find(path) != NANDFiles.end()) {
+        return -105;
+    }
+    NANDFiles[path];
+    return 0;
+}
+
+bool ISFS_ReadFile(const char *path, void *buf, u32 length) {
+    auto file = NANDFiles.find(path);
+    if (file == NANDFiles.end() || file->second.size() != length) {
+        return false;
+    }
+    memcpy(buf, file->second.data(), length);
+    return true;
+}
+
+char *PD_GetDataPath() { return (char *)NAND_PD_PATH; }
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+// The device ID ES_GetDeviceID reports.
+#define NAND_DEVICE_ID 0x0badf00d
+
+// The path PD_GetDataPath reports.
+#define NAND_PD_PATH "/title/00010008/4843434a/data/nocopy/pd.dat"
+
+// Files within the in-memory NAND ISFS calls act upon.
+void NAND_SetFile(const char *path, const std::vector<uint8_t> &contents);
+bool NAND_GetFile(const char *path, std::vector<uint8_t> &contents);
+
+// Fails every ISFS_Write after this many more bytes, having written them.
+// Negative to never fail.
+void NAND_FailWritesAfter(int64_t bytes);
+
+// Reads data/title/pd_decrypted.dat into pd_decrypted_dat.
+bool NAND_LoadTemplate();
@@ -0,0 +1,2 @@
+// Stands in for musl's, as its iconv.h expects.
+#include <stddef.h>
@@ -0,0 +1,42 @@
+// A host stand-in for the parts of libogc the channel's pd.dat and gettext
+// code use. ISFS is backed by the in-memory NAND of nand.cpp.
+#pragma once
+#include <stdio.h>
+
+#include "gctypes.h"
+
+#define ATTRIBUTE_ALIGN(v) __attribute__((aligned(v)))
+
+#define ISFS_OPEN_READ 1
+#define ISFS_OPEN_WRITE 2
+
+enum {
+    CONF_LANG_JAPANESE,
+    CONF_LANG_ENGLISH,
+    CONF_LANG_GERMAN,
+    CONF_LANG_FRENCH,
+    CONF_LANG_SPANISH,
+    CONF_LANG_ITALIAN,
+    CONF_LANG_DUTCH,
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+s32 ES_GetDeviceID(u32 *deviceId);
+
+s32 CONF_GetLanguage(void);
+
+s32 ISFS_Open(const char *path, u8 mode);
+s32 ISFS_Close(s32 fd);
+s32 ISFS_Read(s32 fd, void *buffer, u32 length);
+s32 ISFS_Write(s32 fd, const void *buffer, u32 length);
+s32 ISFS_Seek(s32 fd, s32 where, s32 whence);
+s32 ISFS_Delete(const char *path);
+s32 ISFS_CreateFile(const char *path, u8 attributes, u8 ownerPerm,
+                    u8 groupPerm, u8 otherPerm);
+
+#ifdef __cplusplus
+}
+#endif
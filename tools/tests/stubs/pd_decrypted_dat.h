@@ -0,0 +1,7 @@
+// bin2o's header for data/title/pd_decrypted.dat. nand.cpp reads the file
+// into this at startup instead.
+#pragma once
+#include <gccore.h>
+
+extern u8 pd_decrypted_dat[];
+extern const u32 pd_decrypted_dat_size;
@@ -0,0 +1,55 @@
+// Loads each catalog, checks that its messages are found, and that catalogs
+// with any damaged header field are refused.
+#include <gccore.h>
+#include <string.h>
+#include <vector>
+
+#include "check.h"
+
+#include <catalogs.h>
+#include <gui/gettext.h>
+
+// Only reached by text_language, which is not tested here.
+s32 CONF_GetLanguage(void) { return CONF_LANG_ENGLISH; }
+
+// The header fields as langcat.py writes them.
+enum { MAGIC, VERSION, SLOT_SHIFT, SLOT_COUNT, SIZE };
+
+static void Check(const char *language, const u8 *catalog, u32 size) {
+    std::vector<u32> copy((size + 3) / 4);
+    memcpy(copy.data(), catalog, size);
+    char *data = (char *)copy.data();
+
+    CHECK(LoadLanguage(data, size));
+    CHECK(strcmp(gettext("not a msgid"), "not a msgid") == 0);
+    CHECK(wgettext("not a msgid") == NULL);
+    // Every catalog translates the channel's title.
+    CHECK(wgettext("Choose Channel") != NULL);
+    CHECK(gettext_hashed("Choose Channel", GETTEXT_HASH("Choose Channel")) ==
+          gettext("Choose Channel"));
+
+    // Any inconsistent header field is refused.
+    for (int field = MAGIC; field <= SIZE; field++) {
+        for (u32 delta : {1u, 32u}) {
+            copy[field] += delta;
+            if (LoadLanguage(data, size)) {
+                printf("%s: field %d off by %u loaded\n", language, field,
+                       delta);
+                CheckFailures++;
+            }
+            copy[field] -= delta;
+        }
+    }
+    // Nothing is translated without a language.
+    const char *msgid = "Choose Channel";
+    CHECK(!LoadLanguage(data, sizeof(u32) * SIZE));
+    CHECK(gettext(msgid) == msgid);
+    CHECK(wgettext(msgid) == NULL);
+}
+
+int main() {
+#define CATALOG(name) Check(#name, name##_lang, name##_lang_size);
+    CATALOGS
+#undef CATALOG
+    return CHECK_RESULT;
+}
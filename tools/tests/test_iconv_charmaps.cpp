@@ -0,0 +1,183 @@
+// Opens iconv with every charset alias, and with mangled and unknown
+// spellings of them, checking each resolves to the charmap that musl's
+// linear fuzzycmp scan, as iconv.c used before codepages_hash.h, found.
+#include <errno.h>
+#include <musl/iconv.h>
+#include <random>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "check.h"
+
+#include <musl/locale/codepages.h>
+
+#define MANGLED_PER_ALIAS 200
+
+// As iconv.c declares it, for descriptors of stateful charsets.
+struct stateful_cd {
+    iconv_t base_cd;
+    unsigned state;
+};
+
+static int fuzzycmp(const unsigned char *a, const unsigned char *b) {
+    for (; *a && *b; a++, b++) {
+        while (*a && (*a | 32U) - 'a' > 26 && (unsigned)(*a - '0') > 10U)
+            a++;
+        if ((*a | 32U) != *b)
+            return 1;
+    }
+    return *a != *b;
+}
+
+static size_t find_charmap(const void *name) {
+    const unsigned char *s;
+    if (!*(char *)name)
+        name = charmaps; /* "utf8" */
+    for (s = charmaps; *s;) {
+        if (!fuzzycmp((const unsigned char *)name, s)) {
+            for (; *s; s += strlen((const char *)s) + 1)
+                ;
+            return s + 1 - charmaps;
+        }
+        s += strlen((const char *)s) + 1;
+        if (!*s) {
+            if (s[1] > 0200)
+                s += 2;
+            else
+                s += 2 + (64U - s[1]) * 5;
+        }
+    }
+    return -1;
+}
+
+// Expected returns the descriptor iconv_open_r should produce, with the
+// state of a stateful one removed, or -1 if it should fail.
+static uintptr_t Expected(const char *to, const char *from) {
+    size_t t = find_charmap(to), f = find_charmap(from);
+    if (t == (size_t)-1 || f == (size_t)-1 || charmaps[t] >= 0330) {
+        return (uintptr_t)-1;
+    }
+    return f << 16 | t << 1 | 1;
+}
+
+static uintptr_t Open(const char *to, const char *from) {
+    int error = 0;
+    iconv_t cd = iconv_open_r(to, from, &error);
+    if (cd == (iconv_t)-1) {
+        return error == EINVAL ? (uintptr_t)-1 : 0;
+    }
+    uintptr_t result = (uintptr_t)cd;
+    if (!(result & 1)) {
+        result = (uintptr_t)((struct stateful_cd *)cd)->base_cd;
+    }
+    iconv_close(cd);
+    return result;
+}
+
+static size_t Checked = 0;
+
+// Check opens name as either end of a conversion from or to UTF-8.
+static void Check(const std::string &name) {
+    const char *s = name.c_str();
+    if (Open(s, "utf8") != Expected(s, "utf8") ||
+        Open("utf8", s) != Expected("utf8", s)) {
+        printf("mismatch for \"%s\"\n", s);
+        CheckFailures++;
+    }
+    Checked++;
+}
+
+// Mangle flips the case of letters at random and scatters characters
+// that matching ignores, or nearly ignores, through the name.
+static std::string Mangle(std::mt19937 &random, const std::string &alias) {
+    static const char separators[] = " -_.:/[{@`\x7f\xff";
+    std::string name;
+    for (size_t i = 0; i <= alias.size(); i++) {
+        if (random() % 4 == 0) {
+            name += separators[random() % (sizeof(separators) - 1)];
+        }
+        if (i == alias.size()) {
+            break;
+        }
+        char c = alias[i];
+        if (c >= 'a' && c <= 'z' && random() % 2) {
+            c -= 32;
+        }
+        name += c;
+    }
+    return name;
+}
+
+int main() {
+    // Gather every alias, walking charmaps as find_charmap does.
+    std::vector<std::string> aliases;
+    for (const unsigned char *s = charmaps; *s;) {
+        aliases.push_back((const char *)s);
+        s += strlen((const char *)s) + 1;
+        if (!*s) {
+            if (s[1] > 0200)
+                s += 2;
+            else
+                s += 2 + (64U - s[1]) * 5;
+        }
+    }
+    CHECK(aliases.size() > 70);
+
+    for (const std::string &alias : aliases) {
+        CHECK(find_charmap(alias.c_str()) != (size_t)-1);
+        Check(alias);
+
+        std::string upper = alias;
+        for (char &c : upper) {
+            if (c >= 'a' && c <= 'z') {
+                c -= 32;
+            }
+        }
+        Check(upper);
+
+        // Separators between letters and digits, as charsets are written.
+        std::string dashed, underscored;
+        for (size_t i = 0; i < alias.size(); i++) {
+            if (i != 0 && (alias[i - 1] >= 'a') != (alias[i] >= 'a')) {
+                dashed += '-';
+                underscored += '_';
+            }
+            dashed += alias[i];
+            underscored += alias[i];
+        }
+        Check(dashed);
+        Check(underscored);
+
+        // Prefixes, extensions and trailing separators.
+        Check(alias.substr(0, alias.size() - 1));
+        Check(alias + "x");
+        Check(alias + "0");
+        Check(alias + "-");
+        Check("-" + alias);
+        Check(alias + alias);
+    }
+
+    const char *const unknown[] = {
+        "",         "-",          "--",          "utf",
+        "utf9",     "utf-8-",     "UTF-8:",      "utf:8",
+        "utf[8",    "utf{8",      "bogus",       "cp1253",
+        "iso8859",  "iso885916",  "sjis-",       "SHIFT-JIS2004",
+        "latin10",  "ucs-2le",    "wchar_t",     "WCHAR_T",
+        "eucjp-ms", "big5-hkscs", "gb-18030",    "ISO_646.IRV:1991",
+    };
+    for (const char *name : unknown) {
+        Check(name);
+    }
+
+    std::mt19937 random(19);
+    for (const std::string &alias : aliases) {
+        for (int i = 0; i < MANGLED_PER_ALIAS; i++) {
+            Check(Mangle(random, alias));
+        }
+    }
+
+    printf("%zu aliases, %zu names checked\n", aliases.size(), Checked);
+    return CHECK_RESULT;
+}
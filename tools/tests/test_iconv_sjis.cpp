@@ -0,0 +1,101 @@
+// Converts every code point to Shift_JIS through iconv, comparing the
+// result against JIS X 0208 searched directly and encoded as iconv.c did
+// before revsjis.h. Every double-byte character must also convert back.
+#include <errno.h>
+#include <map>
+#include <musl/iconv.h>
+
+#include "check.h"
+
+#include <musl/locale/jis0208.h>
+
+#define ROWS 84
+#define COLUMNS 94
+
+// Encodes a JIS X 0208 position into its Shift_JIS bytes.
+static unsigned SJIS(unsigned row, unsigned column) {
+    unsigned c = row + 0x21, d = column + 0x21;
+    unsigned lead = (c + 1) / 2 + (c < 95 ? 112 : 176);
+    unsigned trail = c % 2 ? d + 31 + d / 96 : d + 126;
+    return lead << 8 | trail;
+}
+
+// Convert returns the bytes written for input, or -1 on error.
+static int Convert(iconv_t cd, const char *input, size_t length,
+                   unsigned char *output) {
+    char *in = (char *)input, *out = (char *)output;
+    size_t outLength = 4;
+    int error = 0;
+    if (iconv_r(cd, &in, &length, &out, &outLength, &error) == (size_t)-1) {
+        return -1;
+    }
+    return 4 - (int)outLength;
+}
+
+int main() {
+    std::map<unsigned, unsigned> expected;
+    for (unsigned row = 0; row < ROWS; row++) {
+        for (unsigned column = 0; column < COLUMNS; column++) {
+            unsigned c = jis0208[row][column];
+            if (c != 0 && expected.find(c) == expected.end()) {
+                expected[c] = SJIS(row, column);
+            }
+        }
+    }
+
+    iconv_t to = iconv_open_r("SHIFT_JIS", "UTF-32BE", NULL);
+    iconv_t from = iconv_open_r("UTF-32BE", "SHIFT_JIS", NULL);
+    CHECK(to != (iconv_t)-1 && from != (iconv_t)-1);
+
+    size_t mismatches = 0;
+    for (unsigned c = 0x80; c <= 0x10FFFF; c++) {
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            continue;
+        }
+
+        const char input[4] = {(char)(c >> 24), (char)(c >> 16),
+                               (char)(c >> 8), (char)c};
+        unsigned char output[4];
+        int length = Convert(to, input, sizeof(input), output);
+
+        // Characters without a mapping are substituted.
+        unsigned want = '*';
+        if (c == 0xa5) {
+            want = '\\';
+        } else if (c == 0x203e) {
+            want = '~';
+        } else if (c >= 0xff61 && c <= 0xff9f) {
+            want = c - 0xff61 + 0xa1;
+        } else if (expected.count(c) != 0) {
+            want = expected[c];
+        }
+
+        unsigned got = length == 1   ? output[0]
+                       : length == 2 ? (unsigned)(output[0] << 8 | output[1])
+                                     : ~0u;
+        if (got != want) {
+            // Only report the first few, as one bug would report thousands.
+            if (mismatches++ < 10) {
+                printf("U+%04X: expected %04X, got %04X\n", c, want, got);
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+
+    for (auto &entry : expected) {
+        const char input[2] = {(char)(entry.second >> 8), (char)entry.second};
+        unsigned char output[4];
+        CHECK(Convert(from, input, sizeof(input), output) == 4);
+        unsigned c = (unsigned)output[0] << 24 | output[1] << 16 |
+                     output[2] << 8 | output[3];
+        if (c != entry.first) {
+            printf("%04X: expected U+%04X, got U+%04X\n", entry.second,
+                   entry.first, c);
+            CheckFailures++;
+        }
+    }
+
+    iconv_close(to);
+    iconv_close(from);
+    return CHECK_RESULT;
+}
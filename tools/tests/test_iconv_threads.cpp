@@ -0,0 +1,124 @@
+// Converts random strings from several threads at once, starting with an
+// empty descriptor cache, and checks every result against a single thread.
+// Errors must be reported to the call that caused them, through iconv_r.
+// Worth running under -fsanitize=thread as well.
+#include <errno.h>
+#include <iostream>
+#include <kaitai/kaitaistream.h>
+#include <musl/iconv.h>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+
+#define CASES 2000
+#define THREADS 8
+#define ROUNDS 4
+
+struct Case {
+    std::string input;
+    const char *encoding;
+};
+
+// Convert returns the UTF-8 result, or a marker should conversion throw.
+static std::string Convert(const Case &c) {
+    try {
+        return kaitai::kstream::bytes_to_str(
+            kaitai::bytes_span(c.input.data(), c.input.size()), c.encoding);
+    } catch (const std::exception &e) {
+        return "<error>";
+    }
+}
+
+// RunThreads converts every case from each thread, in differing orders.
+static void RunThreads(const std::vector<Case> &cases,
+                       std::vector<std::vector<std::string>> &results) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < cases.size(); i++) {
+                size_t k = (i * 7 + t * (CASES / THREADS)) % cases.size();
+                results[t][k] = Convert(cases[k]);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
+int main() {
+    const char *encodings[] = {"UTF-16BE", "UTF-16LE", "SHIFT_JIS", "UTF-8",
+                               "UTF-32BE", "ISO-8859-1", "CP1252", "BOGUS"};
+    const size_t encodingCount = sizeof(encodings) / sizeof(*encodings);
+
+    std::mt19937 random(11);
+    std::vector<Case> cases(CASES);
+    for (size_t i = 0; i < CASES; i++) {
+        cases[i].encoding = encodings[i % encodingCount];
+        for (size_t j = random() % 24; j != 0; j--) {
+            cases[i].input += (char)(random() % 3 ? 0x30 + random() % 0x50
+                                                  : random());
+        }
+    }
+
+    // bytes_to_str prints each iconv error code, which would bury ours.
+    std::cout.rdbuf(NULL);
+
+    // Every thread first races to fill the descriptor cache.
+    std::vector<std::vector<std::string>> results(
+        THREADS, std::vector<std::string>(CASES));
+    RunThreads(cases, results);
+
+    std::vector<std::string> expected(CASES);
+    for (size_t i = 0; i < CASES; i++) {
+        expected[i] = Convert(cases[i]);
+    }
+
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int t = 0; t < THREADS; t++) {
+            CHECK(results[t] == expected);
+        }
+        RunThreads(cases, results);
+    }
+
+    // Each thread sees only the errors its own calls caused.
+    std::vector<std::thread> threads;
+    std::vector<int> failures(THREADS);
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            int error = 0;
+            iconv_t cd = iconv_open_r("UTF-8", "SHIFT_JIS", &error);
+            if (cd == (iconv_t)-1) {
+                failures[t]++;
+                return;
+            }
+
+            // Odd threads convert a truncated double-byte character.
+            bool invalid = t % 2 != 0;
+            for (int i = 0; i < 1000; i++) {
+                char input[] = "abc\x82\xa0", output[16];
+                char *in = input, *out = output;
+                size_t inLength = invalid ? 4 : 5, outLength = sizeof(output);
+                error = 0;
+                size_t result =
+                    iconv_r(cd, &in, &inLength, &out, &outLength, &error);
+                if (invalid != (result == (size_t)-1) ||
+                    (invalid && error != EINVAL) || (!invalid && error != 0)) {
+                    failures[t]++;
+                }
+            }
+            iconv_close(cd);
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < THREADS; t++) {
+        CHECK(failures[t] == 0);
+    }
+
+    return CHECK_RESULT;
+}
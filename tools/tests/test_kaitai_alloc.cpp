@@ -0,0 +1,81 @@
+// Counts allocations made while parsing pd.dat from memory. Blocks and
+// fixed contents must view the buffer in place, and accessors must not
+// copy, so that only block objects, their substreams and converted
+// strings are ever allocated.
+#include <kaitai/kaitaistream.h>
+#include <new>
+#include <pd-kaitai-struct/pd.h>
+#include <stdlib.h>
+
+#include "check.h"
+#include "nand.h"
+
+#include <channel/pd_data.h>
+#include <pd_decrypted_dat.h>
+
+static size_t Allocations = 0;
+static size_t AllocatedBytes = 0;
+
+void *operator new(size_t size) {
+    Allocations++;
+    AllocatedBytes += size;
+    void *p = malloc(size);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+// A span lies within the file, rather than in a copy of it.
+static bool InFile(const kaitai::bytes_span &span) {
+    const char *file = (const char *)pd_decrypted_dat;
+    return span.data() >= file &&
+           span.data() + span.size() <= file + PD_FILE_LENGTH;
+}
+
+int main() {
+    CHECK(NAND_LoadTemplate());
+
+    // Reading spans from memory never allocates.
+    kaitai::kstream ks(pd_decrypted_dat, PD_FILE_LENGTH);
+    size_t before = Allocations;
+    kaitai::bytes_span span = ks.read_bytes_span(0x100);
+    CHECK(Allocations == before);
+    CHECK(span.data() == (const char *)pd_decrypted_dat);
+    ks.seek(0);
+
+    before = Allocations;
+    size_t beforeBytes = AllocatedBytes;
+    pd_t pd(&ks);
+    size_t parsed = Allocations - before;
+    size_t parsedBytes = AllocatedBytes - beforeBytes;
+    printf("parse: %zu allocations, %zu bytes\n", parsed, parsedBytes);
+
+    // No block, nor the file, is copied.
+    CHECK(parsedBytes < pd._raw_info().size());
+    CHECK(InFile(pd._raw_file_header()));
+    CHECK(InFile(pd._raw_pin_block()));
+    CHECK(InFile(pd._raw_info()));
+    CHECK(InFile(pd._raw_kana()));
+    CHECK(InFile(pd.file_header()->magic()));
+    CHECK(InFile(pd.info()->preset_values()));
+    CHECK(InFile(pd.kana()->preset_value()));
+
+    // Parsed blocks and strings are returned by reference.
+    before = Allocations;
+    size_t length = 0;
+    for (int i = 0; i < 100; i++) {
+        length += pd.info()->first_name().size();
+        length += pd.info()->email_address().size();
+        length += pd.kana()->surname().size();
+        length += pd.pin_block()->pin().size();
+        length += pd.file_header()->version().size();
+    }
+    CHECK(Allocations == before);
+    CHECK(length != 0);
+
+    return CHECK_RESULT;
+}
@@ -0,0 +1,88 @@
+// Checks that PARSE_LAZY reads a block only once its accessor is called,
+// and so reports a corrupt block only then. Built twice: once throwing
+// on failure, and once with KS_NO_EXCEPTIONS, recording failures to
+// pd_t::_status().
+#include <kaitai/exceptions.h>
+#include <kaitai/kaitaistream.h>
+#include <pd-kaitai-struct/pd.h>
+#include <pd-kaitai-struct/pd_fields.h>
+#include <string.h>
+#include <string>
+
+#include "check.h"
+#include "nand.h"
+
+#include <channel/pd_data.h>
+#include <pd_decrypted_dat.h>
+
+static unsigned char Corrupt[PD_FILE_LENGTH];
+
+#define INFO_MAGIC_PATH "/types/info_block/seq/0"
+
+// InfoFailure reads the INFO block, returning where that failed, or an
+// empty string on success.
+static std::string InfoFailure(pd_t &pd) {
+#ifdef KS_NO_EXCEPTIONS
+    pd.info();
+    return pd._status().ok() ? "" : pd._status().path();
+#else
+    try {
+        pd.info();
+    } catch (const kaitai::validation_failed_error &e) {
+        // The message is prefixed by the path.
+        std::string what = e.what();
+        return what.substr(0, what.find(':'));
+    }
+    return "";
+#endif
+}
+
+int main() {
+    CHECK(NAND_LoadTemplate());
+
+    // Only the PIN block is read.
+    {
+        kaitai::kstream ks(pd_decrypted_dat, PD_FILE_LENGTH);
+        pd_t pd(&ks, pd_t::PARSE_LAZY);
+        CHECK(pd._raw_pin_block().size() == 0);
+        CHECK(pd.pin_block()->pin_magic().size() != 0);
+        CHECK(pd._raw_pin_block().size() != 0);
+        CHECK(pd._raw_file_header().size() == 0);
+        CHECK(pd._raw_info().size() == 0);
+        CHECK(pd._raw_kana().size() == 0);
+        CHECK(pd._status().ok());
+    }
+
+    // A bad INFO magic goes unnoticed until the block is read.
+    memcpy(Corrupt, pd_decrypted_dat, PD_FILE_LENGTH);
+    Corrupt[PD_FIELDS[PD_FIELD_INFO_MAGIC].offset] ^= 0xFF;
+    {
+        kaitai::kstream ks(Corrupt, PD_FILE_LENGTH);
+        pd_t pd(&ks, pd_t::PARSE_LAZY);
+        CHECK(pd._status().ok());
+        pd.file_header();
+        pd.pin_block();
+        pd.kana();
+        CHECK(pd._status().ok());
+        CHECK(InfoFailure(pd) == INFO_MAGIC_PATH);
+    }
+
+    // Parsing eagerly reports it immediately.
+    {
+        kaitai::kstream ks(Corrupt, PD_FILE_LENGTH);
+#ifdef KS_NO_EXCEPTIONS
+        pd_t pd(&ks, pd_t::PARSE_EAGER);
+        CHECK(!pd._status().ok());
+#else
+        bool failed = false;
+        try {
+            pd_t pd(&ks, pd_t::PARSE_EAGER);
+        } catch (const kaitai::validation_failed_error &) {
+            failed = true;
+        }
+        CHECK(failed);
+#endif
+    }
+
+    return CHECK_RESULT;
+}
@@ -0,0 +1,87 @@
+// Saves pd.dat through a failing ranged write, then again, checking that
+// NAND ends up holding every block intact. Most blocks are never decrypted.
+#include <string.h>
+#include <vector>
+
+#include "check.h"
+#include "nand.h"
+#include "pd_decrypted_dat.h"
+
+#include <channel/pd_crypto.h>
+#include <channel/pd_data.h>
+
+static std::vector<uint8_t> Encrypt(const std::vector<uint8_t> &plain) {
+    struct PDCryptoSession session;
+    PD_InitCryptoSession(&session, NAND_DEVICE_ID);
+
+    std::vector<uint8_t> cipher(PD_FILE_LENGTH);
+    PD_CryptoEncrypt(&session, session.iv, plain.data(), cipher.data(),
+                     PD_FILE_LENGTH);
+    return cipher;
+}
+
+static std::vector<uint8_t> Decrypt(const std::vector<uint8_t> &cipher) {
+    struct PDCryptoSession session;
+    PD_InitCryptoSession(&session, NAND_DEVICE_ID);
+
+    std::vector<uint8_t> plain(PD_FILE_LENGTH);
+    PD_CryptoDecrypt(&session, session.iv, cipher.data(), plain.data(),
+                     PD_FILE_LENGTH);
+    return plain;
+}
+
+int main() {
+    CHECK(NAND_LoadTemplate());
+
+    // Fill every byte, so that anything lost to zeros shows.
+    std::vector<uint8_t> expected(pd_decrypted_dat,
+                                  pd_decrypted_dat + PD_FILE_LENGTH);
+    for (size_t i = 0; i < expected.size(); i++) {
+        expected[i] ^= (uint8_t)(i * 7 + 1);
+    }
+    NAND_SetFile(NAND_PD_PATH, Encrypt(expected));
+
+    // Only the blocks covering these are decrypted.
+    struct PDRange read = {0x100, 0x20};
+    unsigned char *contents = (unsigned char *)PD_GetFileRanges(&read, 1);
+    CHECK(contents != NULL);
+    CHECK(memcmp(contents + 0x100, expected.data() + 0x100, 0x20) == 0);
+
+    const char update[] = "updated";
+    PD_UpdateFileContents(0x2000, update, sizeof(update));
+    memcpy(expected.data() + 0x2000, update, sizeof(update));
+
+    // The ranged write fails partway through.
+    NAND_FailWritesAfter(0x100);
+    CHECK(!PD_SaveFileContents());
+
+    // Blocks not yet decrypted must still read back correctly.
+    struct PDRange later = {0x1000, 0x40};
+    contents = (unsigned char *)PD_GetFileRanges(&later, 1);
+    CHECK(contents != NULL);
+    if (contents != NULL) {
+        CHECK(memcmp(contents + 0x1000, expected.data() + 0x1000, 0x40) == 0);
+    }
+
+    NAND_FailWritesAfter(-1);
+    CHECK(PD_SaveFileContents());
+
+    std::vector<uint8_t> written;
+    CHECK(NAND_GetFile(NAND_PD_PATH, written));
+    CHECK(written.size() == PD_FILE_LENGTH);
+    if (written.size() == PD_FILE_LENGTH) {
+        CHECK(Decrypt(written) == expected);
+    }
+
+    // Ranged saves work again afterwards.
+    PD_UpdateFileContents(0x3800, update, sizeof(update));
+    memcpy(expected.data() + 0x3800, update, sizeof(update));
+    CHECK(PD_SaveFileContents());
+    CHECK(NAND_GetFile(NAND_PD_PATH, written));
+    CHECK(Decrypt(written) == expected);
+
+    const struct PDBufferStats *stats = PD_GetBufferStats();
+    CHECK(stats->heapAllocations == 0);
+
+    return CHECK_RESULT;
+}
@@ -0,0 +1,99 @@
+// Cross-checks PD_DecodeUTF16BE and PD_EncodeUTF16BE against the codecvt
+// pipelines they replaced, over random fields with characters beyond the
+// BMP, then covers truncation and the cases codecvt cannot express.
+#include <codecvt>
+#include <locale>
+#include <random>
+#include <string.h>
+#include <string>
+
+#include "check.h"
+
+#include <channel/pd_utf16.h>
+
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+#define FIELD_LENGTH 40
+#define ITERATIONS 5000
+
+typedef std::wstring_convert<std::codecvt_utf16<wchar_t>, wchar_t> Convert;
+
+// The former WcharToStringPipeline.
+static std::string LegacyEncode(const wchar_t *input, size_t expected) {
+    std::string result = Convert().to_bytes(input);
+    result.resize(expected);
+    return result;
+}
+
+static std::wstring LegacyDecode(const unsigned char *source, size_t length) {
+    size_t units = 0;
+    while (units < length / 2 && (source[units * 2] | source[units * 2 + 1])) {
+        units++;
+    }
+    return Convert().from_bytes((const char *)source,
+                                (const char *)source + units * 2);
+}
+
+int main() {
+    std::mt19937 random(1234);
+    auto character = [&]() -> wchar_t {
+        switch (random() % 4) {
+        case 0:
+            return 0x20 + random() % 0x5f;
+        case 1:
+            return 0x3040 + random() % 0x60;
+        case 2:
+            return 0xE000 + random() % 0x2000;
+        default:
+            return 0x10000 + random() % 0x100000;
+        }
+    };
+
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        // Strings that always fit, as the PDInfoData members do.
+        std::wstring input;
+        for (size_t units = 0;;) {
+            wchar_t c = character();
+            units += c > 0xFFFF ? 2 : 1;
+            if (units > FIELD_LENGTH / 2 || random() % 8 == 0) {
+                break;
+            }
+            input += c;
+        }
+
+        unsigned char field[FIELD_LENGTH];
+        memset(field, 0xa5, sizeof(field));
+        CHECK(PD_EncodeUTF16BE(input.c_str(), input.size() + 1, field,
+                               FIELD_LENGTH));
+        CHECK(memcmp(field, LegacyEncode(input.c_str(), FIELD_LENGTH).data(),
+                     FIELD_LENGTH) == 0);
+
+        wchar_t output[FIELD_LENGTH / 2 + 1];
+        size_t count =
+            PD_DecodeUTF16BE(field, FIELD_LENGTH, output, FIELD_LENGTH / 2);
+        output[FIELD_LENGTH / 2] = 0;
+        CHECK(count == input.size());
+        CHECK(input == output);
+        CHECK(LegacyDecode(field, FIELD_LENGTH) == output);
+    }
+
+    // A pair is never split when only its first half fits.
+    unsigned char field[4];
+    const wchar_t astral[] = {L'a', (wchar_t)0x1F600, 0};
+    CHECK(!PD_EncodeUTF16BE(astral, 3, field, sizeof(field)));
+    CHECK(memcmp(field, "\0a\0\0", 4) == 0);
+
+    // Unpaired surrogates, which codecvt rejects, are kept as-is.
+    const unsigned char lone[] = {0xD8, 0x3D, 0x00, 0x62, 0xDE, 0x00};
+    wchar_t output[4];
+    CHECK(PD_DecodeUTF16BE(lone, sizeof(lone), output, 4) == 3);
+    CHECK(output[0] == 0xD83D && output[1] == L'b' && output[2] == 0xDE00);
+    CHECK(output[3] == 0);
+
+    // Decoding stops at the first null and at the output's capacity.
+    const unsigned char padded[] = {0x00, 0x61, 0x00, 0x00, 0x00, 0x62};
+    CHECK(PD_DecodeUTF16BE(padded, sizeof(padded), output, 4) == 1);
+    CHECK(PD_DecodeUTF16BE(lone, sizeof(lone), output, 2) == 2);
+
+    return CHECK_RESULT;
+}
@@ -0,0 +1,166 @@
+// Checks that interned wide text is shared between holders of a msgid,
+// survives a language change for its holders, and that idle handles are
+// swept once more than WTEXT_IDLE_MAX gather.
+#include <gccore.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <wchar.h>
+
+#include "check.h"
+
+#include <catalogs.h>
+#include <gui/gettext.h>
+
+// As gettext.cpp defines it.
+#define WTEXT_IDLE_MAX 256
+
+// Only reached by text_language, which is not tested here.
+s32 CONF_GetLanguage(void) { return CONF_LANG_ENGLISH; }
+
+// Catalog returns an aligned copy of a catalog, as it would be loaded.
+static std::vector<u32> Catalog(const u8 *catalog, u32 size) {
+    std::vector<u32> copy((size + 3) / 4);
+    memcpy(copy.data(), catalog, size);
+    return copy;
+}
+
+static bool Load(std::vector<u32> &catalog, u32 size) {
+    return LoadLanguage((char *)catalog.data(), size);
+}
+
+static WTEXT_STATS Stats() {
+    WTEXT_STATS stats;
+    wtext_stats(&stats);
+    return stats;
+}
+
+// SetText replaces a handle as GuiText::SetText does.
+static WTEXT *SetText(WTEXT *current, const char *msgid) {
+    WTEXT *text = wtext_acquire(msgid);
+    wtext_release(current);
+    return text;
+}
+
+int main() {
+    std::vector<u32> fr = Catalog(fr_lang, fr_lang_size);
+    std::vector<u32> de = Catalog(de_lang, de_lang_size);
+    const char *title = "Choose Channel";
+
+    // Every holder of a msgid shares one handle of its translation.
+    CHECK(Load(fr, fr_lang_size));
+    WTEXT_STATS before = Stats();
+    WTEXT *a = wtext_acquire(title);
+    WTEXT *b = wtext_acquire(title);
+    WTEXT_STATS after = Stats();
+    CHECK(a != NULL && a == b);
+    CHECK(wtext_string(a) == wgettext(title));
+    CHECK(strcmp(wtext_msgid(a), title) == 0);
+    CHECK(after.entries == before.entries + 1);
+    CHECK(after.misses == before.misses + 1);
+    CHECK(after.hits == before.hits + 1);
+    after = Stats();
+    for (int i = 0; i < 10; i++) {
+        wtext_release(wtext_acquire(title));
+    }
+    CHECK(Stats().hits == after.hits + 10);
+    CHECK(Stats().allocations == after.allocations);
+    wtext_release(b);
+
+    // Untranslated text is widened and shared all the same.
+    WTEXT *untranslated = wtext_acquire("not a msgid");
+    CHECK(wcscmp(wtext_string(untranslated), L"not a msgid") == 0);
+    CHECK(wtext_acquire("not a msgid") == untranslated);
+    wtext_release(untranslated);
+    wtext_release(untranslated);
+
+    // Setting the same text keeps the handle.
+    before = Stats();
+    WTEXT *same = SetText(a, title);
+    CHECK(same == a);
+    CHECK(Stats().entries == before.entries);
+    CHECK(Stats().allocations == before.allocations);
+    a = same;
+
+    // Private text is neither interned nor shared.
+    before = Stats();
+    WTEXT *typed = wtext_create(L"typed text");
+    WTEXT *typed2 = wtext_create(L"typed text");
+    CHECK(typed != typed2);
+    CHECK(wcscmp(wtext_string(typed), L"typed text") == 0);
+    CHECK(wtext_msgid(typed) == NULL);
+    CHECK(Stats().entries == before.entries + 2);
+    wtext_release(typed);
+    wtext_release(typed2);
+    CHECK(Stats().entries == before.entries);
+    CHECK(Stats().bytes == before.bytes);
+    CHECK(wtext_string(NULL) == NULL && wtext_msgid(NULL) == NULL);
+    wtext_release(NULL);
+
+    // Loading a language frees idle handles, while held ones stay readable.
+    std::wstring french = wtext_string(a);
+    CHECK(Load(de, de_lang_size));
+    CHECK(Stats().entries == 1);
+    CHECK(Stats().idle == 0);
+    CHECK(french == wtext_string(a));
+    CHECK(wtext_msgid(a) != NULL && strcmp(wtext_msgid(a), title) == 0);
+
+    // New holders are given the new translation.
+    WTEXT *german = wtext_acquire(title);
+    CHECK(german != a);
+    CHECK(wtext_string(german) == wgettext(title));
+    CHECK(french != wtext_string(german));
+
+    // Stale handles are freed once released, rather than kept idle.
+    wtext_release(a);
+    CHECK(Stats().entries == 1);
+    CHECK(Stats().idle == 0);
+    wtext_release(german);
+    CHECK(Stats().entries == 1);
+    CHECK(Stats().idle == 1);
+    CHECK(Load(fr, fr_lang_size));
+    CHECK(Stats().entries == 0);
+    CHECK(Stats().bytes == 0);
+    CHECK(Stats().idle == 0);
+
+    // Idle handles gather until there are more than WTEXT_IDLE_MAX.
+    const int count = WTEXT_IDLE_MAX + 44;
+    std::vector<std::string> msgids(count);
+    std::vector<WTEXT *> held(count);
+    for (int i = 0; i < count; i++) {
+        msgids[i] = "text " + std::to_string(i);
+        held[i] = wtext_acquire(msgids[i].c_str());
+    }
+    CHECK(Stats().entries == (u32)count);
+    for (int i = 0; i < WTEXT_IDLE_MAX; i++) {
+        wtext_release(held[i]);
+    }
+    CHECK(Stats().idle == WTEXT_IDLE_MAX);
+    CHECK(Stats().entries == (u32)count);
+
+    // An idle handle is reused rather than reallocated.
+    before = Stats();
+    wtext_release(wtext_acquire(msgids[0].c_str()));
+    CHECK(Stats().allocations == before.allocations);
+    CHECK(Stats().idle == WTEXT_IDLE_MAX);
+
+    // One more sweeps every idle handle, and only those.
+    wtext_release(held[WTEXT_IDLE_MAX]);
+    CHECK(Stats().idle == 0);
+    CHECK(Stats().entries == (u32)(count - WTEXT_IDLE_MAX - 1));
+    for (int i = WTEXT_IDLE_MAX + 1; i < count; i++) {
+        CHECK(wcscmp(wtext_string(held[i]),
+                     std::wstring(msgids[i].begin(), msgids[i].end())
+                         .c_str()) == 0);
+        wtext_release(held[i]);
+    }
+    CHECK(Stats().idle == (u32)(count - WTEXT_IDLE_MAX - 1));
+
+    // Nothing is left once the language changes again.
+    CHECK(Load(de, de_lang_size));
+    CHECK(Stats().entries == 0);
+    CHECK(Stats().bytes == 0);
+    CHECK(Stats().idle == 0);
+
+    return CHECK_RESULT;
+}